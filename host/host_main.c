@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "ssd1322_driver.h"
+#include "lvgl_adapter.h"
+#include "ui.h"
+#include "ui/vars.h"
+#include "ssd1322_sim.h"
+
+static const char *TAG = "HOST";
+
+typedef struct {
+    int frames;              // 模拟的帧数
+    uint32_t period_ms;      // 每帧推进的模拟时间
+    const char *out_dir;     // 帧输出目录，NULL表示不保存
+    long max_avg_us;         // 平均渲染时间上限，0表示不检查
+} host_options_t;
+
+static uint64_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "用法: %s [-n 帧数] [-p 帧间隔ms] [-o 输出目录] [-t 平均渲染上限us]\n", prog);
+}
+
+static int parse_args(int argc, char **argv, host_options_t *opt)
+{
+    opt->frames = 120;
+    opt->period_ms = 33;
+    opt->out_dir = NULL;
+    opt->max_avg_us = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return -1;
+        }
+        if (strcmp(argv[i], "-n") == 0) {
+            opt->frames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-p") == 0) {
+            opt->period_ms = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-o") == 0) {
+            opt->out_dir = argv[++i];
+        } else if (strcmp(argv[i], "-t") == 0) {
+            opt->max_avg_us = atol(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    host_options_t opt;
+    if (parse_args(argc, argv, &opt) != 0) {
+        return 2;
+    }
+
+    ESP_ERROR_CHECK(ssd1322_init());
+    ESP_ERROR_CHECK(lvgl_adapter_init());
+    ESP_ERROR_CHECK(ui_wrapper_init());
+
+    uint64_t total_us = 0;
+    uint64_t max_us = 0;
+    int rendered = 0;
+    int saved = 0;
+
+    for (int i = 0; i < opt.frames; i++) {
+        host_freertos_advance_ms(opt.period_ms);
+
+        // 模拟时钟每秒更新一次文本，驱动subject绑定的标签
+        uint32_t ms = (uint32_t)(i + 1) * opt.period_ms;
+        if (ms / 1000 != (ms - opt.period_ms) / 1000) {
+            char buf[16];
+            uint32_t s = ms / 1000;
+            snprintf(buf, sizeof(buf), "%02u:%02u:%02u",
+                     (unsigned)(s / 3600 % 24), (unsigned)(s / 60 % 60), (unsigned)(s % 60));
+            lvgl_adapter_lock(0);
+            set_var_main_text(buf);
+            lvgl_adapter_unlock();
+        }
+
+        uint64_t t0 = now_us();
+        lvgl_adapter_lock(0);
+        lv_timer_handler();
+        lvgl_adapter_unlock();
+        uint64_t dt = now_us() - t0;
+
+        if (ssd1322_sim_take_dirty()) {
+            rendered++;
+            total_us += dt;
+            if (dt > max_us) {
+                max_us = dt;
+            }
+            if (opt.out_dir) {
+                char path[512];
+                snprintf(path, sizeof(path), "%s/frame_%04d.pgm", opt.out_dir, i);
+                if (ssd1322_sim_save_pgm(path)) {
+                    saved++;
+                } else {
+                    ESP_LOGE(TAG, "Failed to write %s", path);
+                }
+            }
+        }
+    }
+
+    long avg_us = rendered ? (long)(total_us / rendered) : 0;
+    printf("frames=%d rendered=%d saved=%d avg_us=%ld max_us=%lu\n",
+           opt.frames, rendered, saved, avg_us, (unsigned long)max_us);
+
+    if (rendered == 0) {
+        ESP_LOGE(TAG, "No frame reached the panel");
+        return 1;
+    }
+    if (opt.max_avg_us > 0 && avg_us > opt.max_avg_us) {
+        ESP_LOGE(TAG, "Average render time %ld us exceeds limit %ld us", avg_us, opt.max_avg_us);
+        return 1;
+    }
+    return 0;
+}
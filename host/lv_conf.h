@@ -0,0 +1,52 @@
+/**
+ * @file lv_conf.h
+ * 主机端构建使用的LVGL配置，与sdkconfig中的CONFIG_LV_*保持一致。
+ * 未列出的选项使用lv_conf_internal.h中的默认值。
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH                  1
+
+#define LV_USE_STDLIB_MALLOC            LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_STRING            LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_SPRINTF           LV_STDLIB_BUILTIN
+#define LV_MEM_SIZE                     (64 * 1024U)
+#define LV_MEM_SLAB_SIZE_MAX            128
+#define LV_MEM_SLAB_POOL_SIZE           (8 * 1024U)
+
+#define LV_DEF_REFR_PERIOD              33
+#define LV_DPI_DEF                      130
+#define LV_USE_OS                       LV_OS_NONE
+
+#define LV_DRAW_BUF_STRIDE_ALIGN        1
+#define LV_DRAW_BUF_ALIGN               4
+#define LV_DRAW_LAYER_SIMPLE_BUF_SIZE   (24 * 1024)
+#define LV_DRAW_TASK_ARENA_CHUNK_SIZE   (2 * 1024)
+#define LV_USE_DRAW_SW                  1
+#define LV_DRAW_SW_SHADOW_CACHE_SIZE    0
+#define LV_DRAW_SW_CIRCLE_CACHE_SIZE    4
+
+#define LV_USE_LOG                      0
+#define LV_USE_ASSERT_NULL              1
+#define LV_USE_ASSERT_MALLOC            1
+
+#define LV_CACHE_DEF_SIZE               0
+#define LV_IMAGE_HEADER_CACHE_DEF_CNT   0
+#define LV_GRADIENT_MAX_STOPS           2
+
+#define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE 64
+#define LV_OBJ_STYLE_RESOLVED_CACHE_MEM_MAX (8 * 1024)
+#define LV_ANIM_BATCH                   1
+
+#define LV_FONT_MONTSERRAT_14           1
+#define LV_FONT_UNSCII_16               1
+#define LV_FONT_DEFAULT                 &lv_font_unscii_16
+
+#define LV_USE_OBSERVER                 1
+
+#define LV_BUILD_EXAMPLES               0
+#define LV_BUILD_DEMOS                  0
+
+#endif /*LV_CONF_H*/
@@ -0,0 +1,129 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "ssd1322_sim.h"
+#include "ssd1322_driver.h"
+#include "driver/gpio.h"
+
+// SSD1322列地址以4像素为单位，256像素宽的面板从0x1C开始
+#define SIM_COL_OFFSET 0x1C
+
+struct spi_device_t {
+    int unused;
+};
+
+static struct spi_device_t g_dev;
+static uint8_t g_gddram[LCD_V_RES][LCD_H_RES / 2];  // 每字节2个4位像素
+
+static uint8_t g_cmd = 0;
+static int g_param_idx = 0;
+static int g_col_start = 0, g_col_end = 0;   // 单位：字节（2像素）
+static int g_row_start = 0, g_row_end = 0;
+static int g_col = 0, g_row = 0;
+static bool g_dirty = false;
+
+static void sim_command(uint8_t cmd)
+{
+    g_cmd = cmd;
+    g_param_idx = 0;
+    if (cmd == 0x5C) {
+        g_col = g_col_start;
+        g_row = g_row_start;
+    }
+}
+
+static void sim_data(uint8_t data)
+{
+    switch (g_cmd) {
+    case 0x15:
+        if (g_param_idx == 0) {
+            g_col_start = (data - SIM_COL_OFFSET) * 2;
+        } else if (g_param_idx == 1) {
+            g_col_end = (data - SIM_COL_OFFSET) * 2 + 1;
+        }
+        break;
+    case 0x75:
+        if (g_param_idx == 0) {
+            g_row_start = data;
+        } else if (g_param_idx == 1) {
+            g_row_end = data;
+        }
+        break;
+    case 0x5C:
+        if (g_row < LCD_V_RES && g_col >= 0 && g_col < LCD_H_RES / 2) {
+            g_gddram[g_row][g_col] = data;
+            g_dirty = true;
+        }
+        // 窗口内先列后行自增
+        if (++g_col > g_col_end) {
+            g_col = g_col_start;
+            if (++g_row > g_row_end) {
+                g_row = g_row_start;
+            }
+        }
+        return;
+    default:
+        break;
+    }
+    g_param_idx++;
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *bus_config, int dma_chan)
+{
+    (void)host; (void)bus_config; (void)dma_chan;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *dev_config,
+                             spi_device_handle_t *handle)
+{
+    (void)host; (void)dev_config;
+    *handle = &g_dev;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans)
+{
+    (void)handle;
+    const uint8_t *buf = trans->tx_buffer;
+    size_t len = trans->length / 8;
+    bool is_data = host_gpio_get_level(PIN_NUM_DC) != 0;
+
+    for (size_t i = 0; i < len; i++) {
+        if (is_data) {
+            sim_data(buf[i]);
+        } else {
+            sim_command(buf[i]);
+        }
+    }
+    return ESP_OK;
+}
+
+bool ssd1322_sim_take_dirty(void)
+{
+    bool dirty = g_dirty;
+    g_dirty = false;
+    return dirty;
+}
+
+uint8_t ssd1322_sim_get_pixel(int x, int y)
+{
+    uint8_t b = g_gddram[y][x / 2];
+    return (x & 1) ? (b & 0x0F) : (b >> 4);
+}
+
+bool ssd1322_sim_save_pgm(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        return false;
+    }
+    fprintf(f, "P5\n%d %d\n255\n", LCD_H_RES, LCD_V_RES);
+    for (int y = 0; y < LCD_V_RES; y++) {
+        for (int x = 0; x < LCD_H_RES; x++) {
+            uint8_t v = ssd1322_sim_get_pixel(x, y);
+            fputc(v * 17, f);
+        }
+    }
+    fclose(f);
+    return true;
+}
@@ -0,0 +1,25 @@
+#ifndef SSD1322_SIM_H
+#define SSD1322_SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief 读取并清除"有新数据写入显存"标志
+ * @return true 自上次调用以来面板显存被写入过
+ */
+bool ssd1322_sim_take_dirty(void);
+
+/**
+ * @brief 把模拟面板的显存保存为PGM灰度图（4位灰度扩展到8位）
+ * @param path 输出文件路径
+ * @return true 成功，false 失败
+ */
+bool ssd1322_sim_save_pgm(const char *path);
+
+/**
+ * @brief 获取某个像素的4位灰度值
+ */
+uint8_t ssd1322_sim_get_pixel(int x, int y);
+
+#endif // SSD1322_SIM_H
@@ -0,0 +1,13 @@
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+#include <stdlib.h>
+
+// 主机端替代：所有能力位都映射到普通堆
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_8BIT     (1 << 2)
+
+#define heap_caps_malloc(size, caps) malloc(size)
+#define heap_caps_free(ptr)          free(ptr)
+
+#endif // HOST_ESP_HEAP_CAPS_H
@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include "esp_timer.h"
+#include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#define HOST_GPIO_COUNT 64
+
+struct host_semaphore_t {
+    int depth;
+};
+
+static uint64_t g_time_us = 0;           // 模拟时钟
+static uint32_t g_gpio_level[HOST_GPIO_COUNT];
+static TaskHandle_t g_main_task = (TaskHandle_t)1;
+
+/* ---------- 时钟 ---------- */
+
+void host_freertos_advance_ms(uint32_t ms)
+{
+    g_time_us += (uint64_t)ms * 1000;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return (int64_t)g_time_us;
+}
+
+/* ---------- GPIO ---------- */
+
+esp_err_t gpio_config(const gpio_config_t *cfg)
+{
+    (void)cfg;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    if (gpio_num < 0 || gpio_num >= HOST_GPIO_COUNT) {
+        return ESP_FAIL;
+    }
+    g_gpio_level[gpio_num] = level;
+    return ESP_OK;
+}
+
+uint32_t host_gpio_get_level(gpio_num_t gpio_num)
+{
+    if (gpio_num < 0 || gpio_num >= HOST_GPIO_COUNT) {
+        return 0;
+    }
+    return g_gpio_level[gpio_num];
+}
+
+/* ---------- FreeRTOS ---------- */
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_depth, void *arg,
+                       UBaseType_t priority, TaskHandle_t *handle)
+{
+    (void)fn; (void)name; (void)stack_depth; (void)arg; (void)priority;
+    // 任务不会运行，返回一个与主线程不同的句柄，使唤醒逻辑保持原样
+    if (handle) {
+        *handle = (TaskHandle_t)2;
+    }
+    return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    host_freertos_advance_ms(pdTICKS_TO_MS(ticks));
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return pdMS_TO_TICKS(g_time_us / 1000);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return g_main_task;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    (void)task;
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+    (void)clear_on_exit;
+    (void)ticks_to_wait;
+    return 0;
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void)
+{
+    return calloc(1, sizeof(struct host_semaphore_t));
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    (void)ticks;
+    sem->depth++;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem)
+{
+    if (sem->depth == 0) {
+        return pdFALSE;
+    }
+    sem->depth--;
+    return pdTRUE;
+}
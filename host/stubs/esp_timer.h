@@ -0,0 +1,11 @@
+#ifndef HOST_ESP_TIMER_H
+#define HOST_ESP_TIMER_H
+
+#include <stdint.h>
+
+/**
+ * @brief 主机端替代：返回模拟时钟（微秒），由host_freertos_advance_ms推进
+ */
+int64_t esp_timer_get_time(void);
+
+#endif // HOST_ESP_TIMER_H
@@ -0,0 +1,28 @@
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <stdint.h>
+
+// 主机端替代：单线程、模拟时钟的FreeRTOS子集
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define configTICK_RATE_HZ  100
+#define portTICK_PERIOD_MS  (1000 / configTICK_RATE_HZ)
+#define portMAX_DELAY       ((TickType_t)0xffffffffUL)
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define pdPASS  pdTRUE
+
+#define pdMS_TO_TICKS(ms)     ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000))
+#define pdTICKS_TO_MS(ticks)  ((uint32_t)(((uint64_t)(ticks) * 1000) / configTICK_RATE_HZ))
+
+/**
+ * @brief 主机端扩展：推进模拟时钟
+ * @param ms 推进的毫秒数
+ */
+void host_freertos_advance_ms(uint32_t ms);
+
+#endif // HOST_FREERTOS_H
@@ -2,18 +2,31 @@
 #include "ssd1322_driver.h"
 #include "esp_heap_caps.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "driver/gpio.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "ui/ui.h"  // eez studio UI
+#include "freertos/semphr.h"
 
 static const char *TAG = "LVGL_ADAPTER";
 static lv_display_t *g_disp = NULL;
 static uint8_t *g_i4_buffer = NULL;  // 静态I4缓冲区
-static bool ui_initialized = false;  // UI初始化标志
+static TaskHandle_t g_lvgl_task = NULL;
+static SemaphoreHandle_t g_lvgl_mutex = NULL;  // 保护LVGL调用的递归锁
+
+// 空闲时最长睡眠时间，避免等待通知时永久阻塞
+#define LVGL_TASK_MAX_SLEEP_MS 500
+
+// 每次设置窗口（0x15/0x75/0x5C及其参数）需要8次独立的SPI传输，
+// 在10MHz下约折合100字节像素数据的传输时间
+#define SSD1322_WINDOW_COST_BYTES 100
 
 // 函数声明
 static void lvgl_task(void *arg);
+static void lvgl_wake_task(void);
+static uint32_t lvgl_tick_get_cb(void);
+static void lvgl_refr_request_cb(lv_event_t *e);
+static uint32_t lvgl_area_cost_cb(lv_display_t *disp, const lv_area_t *area);
 
 // LVGL flush回调 - L8格式转I4
 static void lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
@@ -65,10 +78,26 @@ static void lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px
     lv_display_flush_ready(disp);
 }
 
+// 失效区域的刷新代价：窗口设置开销 + 需要传输的I4字节数（列地址以4像素为单位）
+static uint32_t lvgl_area_cost_cb(lv_display_t *disp, const lv_area_t *area)
+{
+    (void)disp;
+    uint32_t cols = (area->x2 / 4) - (area->x1 / 4) + 1;
+    uint32_t rows = area->y2 - area->y1 + 1;
+    return SSD1322_WINDOW_COST_BYTES + cols * 2 * rows;
+}
+
 esp_err_t lvgl_adapter_init(void)
 {
     // 初始化LVGL
     lv_init();
+    lv_tick_set_cb(lvgl_tick_get_cb);
+    
+    g_lvgl_mutex = xSemaphoreCreateRecursiveMutex();
+    if (!g_lvgl_mutex) {
+        ESP_LOGE(TAG, "Failed to create LVGL mutex");
+        return ESP_ERR_NO_MEM;
+    }
     
     // 手动创建LVGL显示器
     g_disp = lv_display_create(LCD_H_RES, LCD_V_RES);
@@ -99,8 +128,14 @@ esp_err_t lvgl_adapter_init(void)
     // 设置flush回调
     lv_display_set_flush_cb(g_disp, lvgl_flush_cb);
     
+    // 按SPI传输代价合并失效区域：相邻的小区域合并为一个窗口刷新更快
+    lv_display_set_area_cost_cb(g_disp, lvgl_area_cost_cb);
+    
+    // 有区域失效时唤醒LVGL任务（例如其他任务修改了subject）
+    lv_display_add_event_cb(g_disp, lvgl_refr_request_cb, LV_EVENT_REFR_REQUEST, NULL);
+    
     // 创建LVGL任务
-    xTaskCreate(lvgl_task, "lvgl_task", 4096, NULL, 5, NULL);
+    xTaskCreate(lvgl_task, "lvgl_task", 4096, NULL, 5, &g_lvgl_task);
     
     ESP_LOGI(TAG, "LVGL adapter initialized");
     return ESP_OK;
@@ -111,17 +146,46 @@ static void lvgl_task(void *arg)
 {
     ESP_LOGI(TAG, "Starting LVGL task");
     while (1) {
-        lv_timer_handler();
-        if (ui_initialized) {
-            ui_tick();  // eez UI tick
+        lvgl_adapter_lock(0);
+        uint32_t time_till_next = lv_timer_handler();
+        lvgl_adapter_unlock();
+        
+        // 没有就绪的定时器时睡眠，直到下一个定时器到期或subject变化唤醒
+        if (time_till_next == LV_NO_TIMER_READY || time_till_next > LVGL_TASK_MAX_SLEEP_MS) {
+            time_till_next = LVGL_TASK_MAX_SLEEP_MS;
         }
-        vTaskDelay(pdMS_TO_TICKS(10));
+        TickType_t ticks = pdMS_TO_TICKS(time_till_next);
+        ulTaskNotifyTake(pdTRUE, ticks > 0 ? ticks : 1);
+    }
+}
+
+static void lvgl_wake_task(void)
+{
+    if (g_lvgl_task && xTaskGetCurrentTaskHandle() != g_lvgl_task) {
+        xTaskNotifyGive(g_lvgl_task);
     }
 }
 
-void lvgl_adapter_set_ui_ready(void)
+static uint32_t lvgl_tick_get_cb(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static void lvgl_refr_request_cb(lv_event_t *e)
+{
+    lvgl_wake_task();
+}
+
+bool lvgl_adapter_lock(uint32_t timeout_ms)
+{
+    TickType_t ticks = (timeout_ms == 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    return xSemaphoreTakeRecursive(g_lvgl_mutex, ticks) == pdTRUE;
+}
+
+void lvgl_adapter_unlock(void)
 {
-    ui_initialized = true;
+    xSemaphoreGiveRecursive(g_lvgl_mutex);
+    lvgl_wake_task();
 }
 
 lv_display_t* lvgl_adapter_get_display(void)
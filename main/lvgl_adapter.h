@@ -17,8 +17,15 @@ esp_err_t lvgl_adapter_init(void);
 lv_display_t* lvgl_adapter_get_display(void);
 
 /**
- * @brief 设置UI已准备好
+ * @brief 获取LVGL锁，在LVGL任务以外调用LVGL或修改subject前必须加锁
+ * @param timeout_ms 超时时间（毫秒），0表示一直等待
+ * @return true 成功获取锁，false 超时
  */
-void lvgl_adapter_set_ui_ready(void);
+bool lvgl_adapter_lock(uint32_t timeout_ms);
+
+/**
+ * @brief 释放LVGL锁，并唤醒LVGL任务处理变化
+ */
+void lvgl_adapter_unlock(void);
 
 #endif // LVGL_ADAPTER_H
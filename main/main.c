@@ -28,7 +28,9 @@ void app_main(void)
     vTaskDelay(pdMS_TO_TICKS(100));
     
     // 强制刷新屏幕
+    lvgl_adapter_lock(0);
     lv_refr_now(NULL);
+    lvgl_adapter_unlock();
     
     ESP_LOGI(TAG, "All initialized successfully");
     
@@ -14,7 +14,37 @@ objects_t objects;
 lv_obj_t *tick_value_change_obj;
 uint32_t active_theme_index = 0;
 
-void create_screen_main() {
+// 屏幕按步骤创建：每个步骤创建一个顶层控件，便于分时间片增量构建
+typedef void (*create_screen_step_func_t)();
+
+#if UI_STATIC_WIDGET_TREE
+
+// 紧凑创建路径：每个控件只创建一次并挂一个const样式，不分配本地样式
+static void create_screen_main_root() {
+    lv_obj_t *obj = lv_obj_create(0);
+    objects.main = obj;
+    lv_obj_add_style(obj, &style_main, 0);
+}
+
+static void create_screen_main_label() {
+    lv_obj_t *obj = lv_label_create(objects.main);
+    lv_obj_add_style(obj, &style_main_label, 0);
+#if defined(EEZ_FOR_LVGL)
+    lv_label_set_text(obj, "Hello, world!");
+#else
+    lv_label_bind_text(obj, get_var_subject(FLOW_GLOBAL_VARIABLE_MAIN_TEXT), NULL);
+#endif
+}
+
+static void create_screen_main_image() {
+    lv_obj_t *obj = lv_image_create(objects.main);
+    lv_obj_add_style(obj, &style_main_image, 0);
+    lv_image_set_src(obj, &img_sunning);
+}
+
+#else
+
+static void create_screen_main_root() {
     lv_obj_t *obj = lv_obj_create(0);
     objects.main = obj;
     lv_obj_set_pos(obj, 0, 0);
@@ -23,17 +53,29 @@ void create_screen_main() {
     // 设置黑色背景
     lv_obj_set_style_bg_color(obj, lv_color_make(0x00, 0x00, 0x00), 0);
     lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
-    
+}
+
+static void create_screen_main_label() {
     {
-        lv_obj_t *parent_obj = obj;
+        lv_obj_t *parent_obj = objects.main;
         {
             lv_obj_t *obj = lv_label_create(parent_obj);
             lv_obj_set_pos(obj, 21, 24);
             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+#if defined(EEZ_FOR_LVGL)
             lv_label_set_text(obj, "Hello, world!");
+#else
+            lv_label_bind_text(obj, get_var_subject(FLOW_GLOBAL_VARIABLE_MAIN_TEXT), NULL);
+#endif
             // 设置白色文字
             lv_obj_set_style_text_color(obj, lv_color_make(0xFF, 0xFF, 0xFF), 0);
         }
+    }
+}
+
+static void create_screen_main_image() {
+    {
+        lv_obj_t *parent_obj = objects.main;
         {
             lv_obj_t *obj = lv_image_create(parent_obj);
             lv_obj_set_pos(obj, 143, 0);
@@ -41,14 +83,38 @@ void create_screen_main() {
             lv_image_set_src(obj, &img_sunning);
         }
     }
-    
-    tick_screen_main();
 }
 
-void tick_screen_main() {
+#endif
+
+static const create_screen_step_func_t screen_main_steps[] = {
+    create_screen_main_root,
+    create_screen_main_label,
+    create_screen_main_image,
+};
+
+// 构建步骤期间关闭样式刷新，整个屏幕完成后只刷新一次
+static void run_screen_step(create_screen_step_func_t step) {
+    lv_obj_enable_style_refresh(false);
+    step();
+    lv_obj_enable_style_refresh(true);
 }
 
+static void finish_screen(lv_obj_t *screen) {
+    lv_obj_refresh_style(screen, LV_PART_ANY, LV_STYLE_PROP_ANY);
+}
 
+void create_screen_main() {
+    for (size_t i = 0; i < sizeof(screen_main_steps) / sizeof(screen_main_steps[0]); i++) {
+        run_screen_step(screen_main_steps[i]);
+    }
+    finish_screen(objects.main);
+}
+
+#if defined(EEZ_FOR_LVGL)
+
+void tick_screen_main() {
+}
 
 typedef void (*tick_screen_func_t)();
 tick_screen_func_t tick_screen_funcs[] = {
@@ -61,6 +127,10 @@ void tick_screen_by_id(enum ScreensEnum screenId) {
     tick_screen_funcs[screenId - 1]();
 }
 
+#endif
+
+#if defined(EEZ_FOR_LVGL)
+
 void create_screens() {
     // 不使用默认主题，手动设置颜色
     create_screen_main();
@@ -68,3 +138,183 @@ void create_screens() {
     // 加载主屏幕
     lv_scr_load(objects.main);
 }
+
+#else
+
+typedef struct {
+    const create_screen_step_func_t *steps;
+    uint16_t step_count;
+    uint16_t first_object;  // 该屏幕在objects_t中的第一个对象
+    uint16_t object_count;  // 该屏幕在objects_t中的对象数
+    size_t mem_cost;        // 创建时测得的LVGL堆占用
+    uint32_t last_used;     // 最近一次加载的序号，用于LRU
+} screen_cache_entry_t;
+
+#define SCREEN_STEPS(steps) steps, sizeof(steps) / sizeof(steps[0])
+
+static screen_cache_entry_t screen_cache[SCREEN_COUNT] = {
+    { SCREEN_STEPS(screen_main_steps), 0, 1, 0, 0 },
+};
+static uint32_t screen_use_counter = 0;
+
+// 增量构建任务，同一时间只有一个
+typedef struct {
+    screen_cache_entry_t *entry;
+    enum ScreensEnum screen_id;
+    uint16_t next_step;
+    uint32_t slice_budget_ms;
+    uint32_t start_tick;
+    lv_timer_t *timer;
+    screen_build_done_cb_t done_cb;
+    screen_build_stats_t stats;
+} screen_build_job_t;
+
+static screen_build_job_t build_job;
+static screen_build_stats_t last_build_stats;
+
+static size_t get_mem_used() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+static lv_obj_t **get_screen_slot(screen_cache_entry_t *entry) {
+    return &((lv_obj_t **)&objects)[entry->first_object];
+}
+
+static void run_build_step(screen_cache_entry_t *entry, uint16_t step) {
+    size_t used_before = get_mem_used();
+    run_screen_step(entry->steps[step]);
+    if (step + 1 == entry->step_count) {
+        finish_screen(*get_screen_slot(entry));
+    }
+    size_t used_after = get_mem_used();
+    entry->mem_cost += used_after > used_before ? used_after - used_before : 0;
+}
+
+static void finish_build_job() {
+    screen_build_job_t job = build_job;
+    lv_timer_delete(job.timer);
+    lv_memzero(&build_job, sizeof(build_job));
+
+    job.stats.total_ms = lv_tick_elaps(job.start_tick);
+    last_build_stats = job.stats;
+    if (job.done_cb) {
+        job.done_cb(job.screen_id, &last_build_stats);
+    }
+}
+
+static void build_job_timer_cb(lv_timer_t *timer) {
+    LV_UNUSED(timer);
+    uint32_t slice_start = lv_tick_get();
+    // 每个时间片至少执行一步，超出预算后让出给lv_timer_handler
+    do {
+        run_build_step(build_job.entry, build_job.next_step++);
+    } while (build_job.next_step < build_job.entry->step_count &&
+             lv_tick_elaps(slice_start) < build_job.slice_budget_ms);
+
+    uint32_t slice_ms = lv_tick_elaps(slice_start);
+    build_job.stats.slices++;
+    if (slice_ms > build_job.stats.worst_slice_ms) {
+        build_job.stats.worst_slice_ms = slice_ms;
+    }
+
+    if (build_job.next_step >= build_job.entry->step_count) {
+        finish_build_job();
+    }
+}
+
+bool build_screen_async(enum ScreensEnum screenId, uint32_t slice_budget_ms, screen_build_done_cb_t done_cb) {
+    screen_cache_entry_t *entry = &screen_cache[screenId - 1];
+    if (build_job.entry != NULL) {
+        return false;
+    }
+    if (*get_screen_slot(entry) != NULL) {
+        // 已经创建，直接报告完成
+        lv_memzero(&last_build_stats, sizeof(last_build_stats));
+        if (done_cb) {
+            done_cb(screenId, &last_build_stats);
+        }
+        return true;
+    }
+
+    build_job.timer = lv_timer_create(build_job_timer_cb, 0, NULL);
+    if (build_job.timer == NULL) {
+        return false;
+    }
+    build_job.entry = entry;
+    build_job.screen_id = screenId;
+    build_job.next_step = 0;
+    build_job.slice_budget_ms = slice_budget_ms;
+    build_job.start_tick = lv_tick_get();
+    build_job.done_cb = done_cb;
+    entry->mem_cost = 0;
+    return true;
+}
+
+const screen_build_stats_t *get_last_screen_build_stats() {
+    return &last_build_stats;
+}
+
+lv_obj_t *get_screen(enum ScreensEnum screenId) {
+    screen_cache_entry_t *entry = &screen_cache[screenId - 1];
+    lv_obj_t **slot = get_screen_slot(entry);
+    if (build_job.entry == entry) {
+        // 正在增量构建，同步完成剩余步骤
+        while (build_job.next_step < entry->step_count) {
+            run_build_step(entry, build_job.next_step++);
+        }
+        build_job.stats.slices++;
+        finish_build_job();
+    } else if (*slot == NULL) {
+        entry->mem_cost = 0;
+        for (uint16_t i = 0; i < entry->step_count; i++) {
+            run_build_step(entry, i);
+        }
+    }
+    entry->last_used = ++screen_use_counter;
+    return *slot;
+}
+
+static bool is_screen_in_use(lv_obj_t *screen) {
+    lv_display_t *disp = lv_obj_get_display(screen);
+    return screen == lv_display_get_screen_active(disp) ||
+           screen == lv_display_get_screen_prev(disp) ||
+           screen == lv_display_get_screen_loading(disp);
+}
+
+void evict_screens() {
+    while (1) {
+        size_t cached = 0;
+        screen_cache_entry_t *lru = NULL;
+        for (int i = 0; i < SCREEN_COUNT; i++) {
+            screen_cache_entry_t *entry = &screen_cache[i];
+            lv_obj_t *screen = *get_screen_slot(entry);
+            if (screen == NULL || entry == build_job.entry || is_screen_in_use(screen)) {
+                continue;
+            }
+            cached += entry->mem_cost;
+            if (lru == NULL || entry->last_used < lru->last_used) {
+                lru = entry;
+            }
+        }
+        if (lru == NULL || cached <= UI_SCREEN_CACHE_BUDGET) {
+            return;
+        }
+        lv_obj_delete(*get_screen_slot(lru));
+        // 子对象随屏幕一起删除，清空objects_t中对应的指针
+        memset(get_screen_slot(lru), 0, lru->object_count * sizeof(lv_obj_t *));
+    }
+}
+
+void create_screens() {
+    // 屏幕按需创建，这里只重置缓存状态
+    memset(&objects, 0, sizeof(objects));
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        screen_cache[i].mem_cost = 0;
+        screen_cache[i].last_used = 0;
+    }
+    screen_use_counter = 0;
+}
+
+#endif
@@ -17,13 +17,49 @@ enum ScreensEnum {
     SCREEN_ID_MAIN = 1,
 };
 
+#define SCREEN_COUNT 1
+
 void create_screen_main();
+
+#if defined(EEZ_FOR_LVGL)
 void tick_screen_main();
 
 void tick_screen_by_id(enum ScreensEnum screenId);
 void tick_screen(int screen_index);
+#endif
 
 void create_screens();
+
+#if !defined(EEZ_FOR_LVGL)
+// 屏幕在第一次loadScreen时才创建。不可见的屏幕占用的LVGL堆超过该预算时，
+// 按最近最少使用顺序删除，下次加载时重新创建。
+// 屏幕需要保留的状态必须放在subject中（见vars.h），不能只存在控件里。
+#ifndef UI_SCREEN_CACHE_BUDGET
+#define UI_SCREEN_CACHE_BUDGET (16 * 1024)
+#endif
+
+// 返回屏幕对象，尚未创建时立即创建
+lv_obj_t *get_screen(enum ScreensEnum screenId);
+
+// 删除不可见的屏幕，直到缓存的屏幕占用不超过UI_SCREEN_CACHE_BUDGET
+void evict_screens();
+
+// 增量构建的耗时统计（毫秒，精度为LVGL tick）
+typedef struct {
+    uint32_t total_ms;        // 从开始到完成的总时间
+    uint32_t worst_slice_ms;  // 单个时间片的最长耗时
+    uint32_t slices;          // 使用的时间片数
+} screen_build_stats_t;
+
+typedef void (*screen_build_done_cb_t)(enum ScreensEnum screenId, const screen_build_stats_t *stats);
+
+// 把屏幕创建拆分到多个lv_timer周期中执行，每个周期最多占用slice_budget_ms，
+// 完成后调用done_cb。同一时间只能有一个构建任务，已有任务时返回false。
+bool build_screen_async(enum ScreensEnum screenId, uint32_t slice_budget_ms, screen_build_done_cb_t done_cb);
+
+// 最近一次完成的构建统计
+const screen_build_stats_t *get_last_screen_build_stats();
+#endif
 
 
 #ifdef __cplusplus
@@ -5,4 +5,50 @@
 #include "ui.h"
 #include "screens.h"
 
+#if UI_STATIC_WIDGET_TREE
 
+//
+// Style: main screen
+//
+
+static const lv_style_const_prop_t style_main_props[] = {
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(0),
+    LV_STYLE_CONST_WIDTH(256),
+    LV_STYLE_CONST_HEIGHT(64),
+    // 黑色背景
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PROPS_END
+};
+LV_STYLE_CONST_INIT(style_main, style_main_props);
+
+//
+// Style: main screen / label
+//
+
+static const lv_style_const_prop_t style_main_label_props[] = {
+    LV_STYLE_CONST_X(21),
+    LV_STYLE_CONST_Y(24),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    // 白色文字
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_PROPS_END
+};
+LV_STYLE_CONST_INIT(style_main_label, style_main_label_props);
+
+//
+// Style: main screen / image
+//
+
+static const lv_style_const_prop_t style_main_image_props[] = {
+    LV_STYLE_CONST_X(143),
+    LV_STYLE_CONST_Y(0),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_PROPS_END
+};
+LV_STYLE_CONST_INIT(style_main_image, style_main_image_props);
+
+#endif
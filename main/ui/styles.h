@@ -7,7 +7,23 @@
 extern "C" {
 #endif
 
+// 为1时屏幕使用编译期生成的const样式表创建，不分配本地样式
+#ifndef UI_STATIC_WIDGET_TREE
+#define UI_STATIC_WIDGET_TREE 1
+#endif
+
+#if UI_STATIC_WIDGET_TREE
+
+// Style: main screen
+extern const lv_style_t style_main;
 
+// Style: main screen / label
+extern const lv_style_t style_main_label;
+
+// Style: main screen / image
+extern const lv_style_t style_main_image;
+
+#endif
 
 #ifdef __cplusplus
 }
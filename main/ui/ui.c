@@ -31,27 +31,29 @@ void ui_tick() {
 
 static int16_t currentScreen = -1;
 
-static lv_obj_t *getLvglObjectFromIndex(int32_t index) {
-    if (index == -1) {
-        return 0;
-    }
-    return ((lv_obj_t **)&objects)[index];
-}
-
 void loadScreen(enum ScreensEnum screenId) {
     currentScreen = screenId - 1;
-    lv_obj_t *screen = getLvglObjectFromIndex(currentScreen);
+    lv_obj_t *screen = get_screen(screenId);
     lv_scr_load_anim(screen, LV_SCR_LOAD_ANIM_FADE_IN, 200, 0, false);
+    // 新屏幕已开始加载，超出预算的旧屏幕可以释放
+    evict_screens();
+}
+
+static void load_screen_async_done_cb(enum ScreensEnum screenId, const screen_build_stats_t *stats) {
+    LV_UNUSED(stats);
+    loadScreen(screenId);
+}
+
+bool loadScreenAsync(enum ScreensEnum screenId, uint32_t slice_budget_ms) {
+    return build_screen_async(screenId, slice_budget_ms, load_screen_async_done_cb);
 }
 
 void ui_init() {
+    // subject只初始化一次：重新创建屏幕时不能清空已有observer的subject
+    init_vars();
     create_screens();
     loadScreen(SCREEN_ID_MAIN);
 
 }
 
-void ui_tick() {
-    tick_screen(currentScreen);
-}
-
 #endif
@@ -20,10 +20,14 @@ extern "C" {
 
 
 void ui_init();
-void ui_tick();
 
-#if !defined(EEZ_FOR_LVGL)
+#if defined(EEZ_FOR_LVGL)
+void ui_tick();
+#else
 void loadScreen(enum ScreensEnum screenId);
+
+// 分时间片构建屏幕，构建完成后再用loadScreen显示，统计见get_last_screen_build_stats
+bool loadScreenAsync(enum ScreensEnum screenId, uint32_t slice_budget_ms);
 #endif
 
 #ifdef __cplusplus
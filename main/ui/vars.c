@@ -0,0 +1,31 @@
+#include <string.h>
+
+#include "vars.h"
+
+#if !defined(EEZ_FOR_LVGL)
+
+#define MAIN_TEXT_MAX_LEN 32
+
+lv_subject_t flow_global_subjects[FLOW_GLOBAL_VARIABLE_COUNT];
+
+static char main_text_buf[MAIN_TEXT_MAX_LEN];
+static char main_text_prev_buf[MAIN_TEXT_MAX_LEN];
+
+void init_vars() {
+    lv_subject_init_string(&flow_global_subjects[FLOW_GLOBAL_VARIABLE_MAIN_TEXT],
+                           main_text_buf, main_text_prev_buf, sizeof(main_text_buf), "Hello, world!");
+}
+
+lv_subject_t *get_var_subject(enum FlowGlobalVariables var) {
+    return &flow_global_subjects[var];
+}
+
+const char *get_var_main_text() {
+    return lv_subject_get_string(&flow_global_subjects[FLOW_GLOBAL_VARIABLE_MAIN_TEXT]);
+}
+
+void set_var_main_text(const char *value) {
+    lv_subject_copy_string(&flow_global_subjects[FLOW_GLOBAL_VARIABLE_MAIN_TEXT], value);
+}
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <lvgl.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -15,11 +16,30 @@ extern "C" {
 // Flow global variables
 
 enum FlowGlobalVariables {
-    FLOW_GLOBAL_VARIABLE_NONE
+    FLOW_GLOBAL_VARIABLE_NONE,
+    FLOW_GLOBAL_VARIABLE_MAIN_TEXT,
+    FLOW_GLOBAL_VARIABLE_COUNT
 };
 
+#if !defined(EEZ_FOR_LVGL)
+// 仅非flow构建使用：每个全局变量对应一个lv_subject_t，控件在创建时绑定，值变化时只通知绑定的控件。
+// EEZ flow运行时不知道这些subject，flow构建仍使用tick_screen轮询。
+extern lv_subject_t flow_global_subjects[FLOW_GLOBAL_VARIABLE_COUNT];
+
+// 由ui_init调用一次，不能在屏幕重建时再次调用（会清空已有的observer）
+void init_vars();
+lv_subject_t *get_var_subject(enum FlowGlobalVariables var);
+#endif
+
 // Native global variables
 
+#if !defined(EEZ_FOR_LVGL)
+// 以下函数会访问subject并触发observer更新控件，必须在LVGL任务中调用，
+// 或在其他任务中持有lvgl_adapter_lock()时调用。
+// get_var_main_text返回的指针指向subject内部缓冲区，只在持有锁期间有效。
+extern const char *get_var_main_text();
+extern void set_var_main_text(const char *value);
+#endif
 
 
 #ifdef __cplusplus
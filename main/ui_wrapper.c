@@ -6,11 +6,10 @@ static const char *TAG = "UI_WRAPPER";
 
 esp_err_t ui_wrapper_init(void)
 {
-    // 调用eez studio生成的UI初始化
+    // 调用eez studio生成的UI初始化（LVGL任务已在运行，需加锁）
+    lvgl_adapter_lock(0);
     ui_init();
-    
-    // 通知LVGL适配器UI已就绪
-    lvgl_adapter_set_ui_ready();
+    lvgl_adapter_unlock();
     
     ESP_LOGI(TAG, "EEZ UI initialized successfully");
     return ESP_OK;
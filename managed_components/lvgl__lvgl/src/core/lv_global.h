@@ -31,7 +31,7 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon.h"
 #include "../stdlib/builtin/lv_tlsf.h"
 
-#if LV_USE_FONT_COMPRESSED
+#if LV_USE_FONT_COMPRESSED || LV_FONT_GLYPH_CACHE_SIZE || LV_FONT_FMT_TXT_CMAP_INDEX || LV_FONT_FMT_TXT_KERN_INDEX
 #include "../font/lv_font_fmt_txt_private.h"
 #endif
 
@@ -57,6 +57,11 @@ extern "C" {
  *********************/
 #define ZERO_MEM_SENTINEL  0xa1b2c3d4
 
+#if LV_ANIM_BATCH
+/**Number of objects remembered as invalidated for drawing-only style changes in a frame*/
+#define LV_OBJ_STYLE_INV_BATCH_CNT  16
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -98,6 +103,18 @@ typedef struct _lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    uint32_t style_resolved_gen;
+    uint32_t style_resolved_obj_cnt;
+    uint32_t style_resolved_mem_used;
+    uint32_t style_resolved_hit_cnt;
+    uint32_t style_resolved_miss_cnt;
+#endif
+#if LV_ANIM_BATCH
+    const lv_obj_t * style_inv_objs[LV_OBJ_STYLE_INV_BATCH_CNT];
+    lv_area_t style_inv_areas[LV_OBJ_STYLE_INV_BATCH_CNT];
+    uint32_t style_inv_cnt;
+#endif
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
@@ -211,6 +228,21 @@ typedef struct _lv_global_t {
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
 
+#if LV_FONT_GLYPH_CACHE_SIZE
+    lv_cache_t * font_glyph_cache;
+    lv_font_glyph_cache_stats_t font_glyph_cache_stats;
+#endif
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+    lv_ll_t font_cmap_index_ll;
+    lv_font_fmt_txt_cmap_index_t * font_cmap_index_last;
+#endif
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+    lv_ll_t font_kern_index_ll;
+    lv_font_fmt_txt_kern_index_t * font_kern_index_last;
+#endif
+
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
 #endif
@@ -633,6 +633,9 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 #if LV_OBJ_ID_AUTO_ASSIGN
     lv_obj_free_id(obj);
 #endif
+
+    lv_obj_style_resolved_cache_free(obj);
+    lv_obj_style_inv_batch_reset();
 }
 
 static void lv_obj_draw(lv_event_t * e)
@@ -990,6 +993,9 @@ static void update_obj_state(lv_obj_t * obj, lv_state_t new_state)
 
     lv_state_t prev_state = obj->state;
 
+    /*The children can inherit different values in the new state*/
+    lv_obj_style_resolved_cache_invalidate();
+
     lv_style_state_cmp_t cmp_res = lv_obj_style_state_compare(obj, prev_state, new_state);
     /*If there is no difference in styles there is nothing else to do*/
     if(cmp_res == LV_STYLE_STATE_CMP_SAME) {
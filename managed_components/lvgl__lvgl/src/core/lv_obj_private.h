@@ -60,6 +60,9 @@ struct _lv_obj_t {
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#endif
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    lv_obj_style_resolved_cache_t * style_resolved_cache;   /**< Lazily allocated, see `LV_OBJ_STYLE_RESOLVED_CACHE_SIZE`*/
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
@@ -10,6 +10,8 @@
 #include "../misc/lv_anim_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_draw_private.h"
+#include "../misc/lv_area_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../misc/lv_color.h"
@@ -23,6 +25,14 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define resolved_gen LV_GLOBAL_DEFAULT()->style_resolved_gen
+#define resolved_obj_cnt LV_GLOBAL_DEFAULT()->style_resolved_obj_cnt
+#define resolved_mem_used LV_GLOBAL_DEFAULT()->style_resolved_mem_used
+#define resolved_hit_cnt LV_GLOBAL_DEFAULT()->style_resolved_hit_cnt
+#define resolved_miss_cnt LV_GLOBAL_DEFAULT()->style_resolved_miss_cnt
+#define inv_batch_objs LV_GLOBAL_DEFAULT()->style_inv_objs
+#define inv_batch_areas LV_GLOBAL_DEFAULT()->style_inv_areas
+#define inv_batch_cnt LV_GLOBAL_DEFAULT()->style_inv_cnt
 
 /**********************
  *      TYPEDEFS
@@ -60,6 +70,13 @@ static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+static lv_obj_style_resolved_entry_t * resolved_cache_get_set(const lv_obj_t * obj, lv_part_t part,
+                                                              lv_style_prop_t prop);
+#endif
+#if LV_ANIM_BATCH
+static void invalidate_batched(lv_obj_t * obj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -239,6 +256,8 @@ void lv_obj_remove_style(lv_obj_t * obj, const lv_style_t * style, lv_style_sele
          *Therefore it doesn't needs to be incremented*/
     }
 
+    if(deleted) lv_obj_style_resolved_cache_invalidate();
+
     if(deleted && prop != LV_STYLE_PROP_INV) {
         full_cache_refresh(obj, part);
         lv_obj_refresh_style(obj, part, prop);
@@ -268,10 +287,23 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The resolved values can be outdated even if the refresh is disabled*/
+    lv_obj_style_resolved_cache_invalidate();
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
 
+#if LV_ANIM_BATCH
+    /*Only the object needs to be redrawn. Animated colors, opacities, etc. do it in every frame*/
+    if(prop != LV_STYLE_PROP_ANY &&
+       !lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_ALL & ~LV_STYLE_PROP_FLAG_INHERITABLE)) {
+        invalidate_batched(obj);
+        LV_PROFILER_STYLE_END;
+        return;
+    }
+#endif
+
     lv_obj_invalidate(obj);
 
     bool is_layout_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYOUT_UPDATE);
@@ -352,14 +384,91 @@ lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_
 {
     LV_ASSERT_NULL(obj)
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    const uint8_t part_id = (uint8_t)(part >> 16);
+    lv_obj_style_resolved_entry_t * set = resolved_cache_get_set(obj, part, prop);
+    if(set) {
+        if(set[0].prop == prop && set[0].part_id == part_id && set[0].state == obj->state) {
+            resolved_hit_cnt++;
+            return set[0].value;
+        }
+        if(set[1].prop == prop && set[1].part_id == part_id && set[1].state == obj->state) {
+            resolved_hit_cnt++;
+            return set[1].value;
+        }
+    }
+#endif
+
     lv_style_selector_t selector = part | obj->state;
     lv_style_value_t value_act = { .ptr = NULL };
     lv_style_res_t found;
 
     found = get_selector_style_prop(obj, selector, prop, &value_act);
-    if(found == LV_STYLE_RES_FOUND) return value_act;
+    if(found != LV_STYLE_RES_FOUND) value_act = lv_style_prop_get_default(prop);
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    if(set) {
+        /*Keep the last added entry as the second candidate*/
+        set[1] = set[0];
+        set[0].value = value_act;
+        set[0].prop = prop;
+        set[0].part_id = part_id;
+        set[0].state = obj->state;
+        resolved_miss_cnt++;
+    }
+#endif
+
+    return value_act;
+}
+
+void lv_obj_style_resolved_cache_get_info(lv_obj_style_resolved_cache_info_t * info)
+{
+    LV_ASSERT_NULL(info);
+
+    lv_memzero(info, sizeof(lv_obj_style_resolved_cache_info_t));
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    info->obj_cnt = resolved_obj_cnt;
+    info->mem_used = resolved_mem_used;
+    info->mem_max = LV_OBJ_STYLE_RESOLVED_CACHE_MEM_MAX;
+    info->hit_cnt = resolved_hit_cnt;
+    info->miss_cnt = resolved_miss_cnt;
+#endif
+}
+
+void lv_obj_style_resolved_cache_reset_stats(void)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    resolved_hit_cnt = 0;
+    resolved_miss_cnt = 0;
+#endif
+}
 
-    return lv_style_prop_get_default(prop);
+void lv_obj_style_resolved_cache_invalidate(void)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    resolved_gen++;
+#endif
+}
+
+void lv_obj_style_resolved_cache_free(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    if(obj->style_resolved_cache == NULL) return;
+
+    lv_free(obj->style_resolved_cache);
+    obj->style_resolved_cache = NULL;
+    resolved_obj_cnt--;
+    resolved_mem_used -= sizeof(lv_obj_style_resolved_cache_t);
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+void lv_obj_style_inv_batch_reset(void)
+{
+#if LV_ANIM_BATCH
+    inv_batch_cnt = 0;
+#endif
 }
 
 bool lv_obj_has_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
@@ -1217,3 +1326,74 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 
     return LV_STYLE_RES_NOT_FOUND;
 }
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+/**
+ * Get the 2 cache entries where a style property of an object can be.
+ * The cache is allocated here if the object has none yet and the memory limit allows it.
+ * @param obj       pointer to an object
+ * @param part      the part whose property is looked up
+ * @param prop      the property to look up
+ * @return          pointer to the first of the 2 entries (they can store other properties too) or NULL if not cached
+ */
+static lv_obj_style_resolved_entry_t * resolved_cache_get_set(const lv_obj_t * obj, lv_part_t part,
+                                                              lv_style_prop_t prop)
+{
+    /*The styles are read in temporary states (e.g. by transitions), don't cache them*/
+    if(obj->skip_trans) return NULL;
+
+    lv_obj_style_resolved_cache_t * cache = obj->style_resolved_cache;
+    if(cache == NULL) {
+        if(obj->is_deleting) return NULL;
+        if(resolved_mem_used + sizeof(lv_obj_style_resolved_cache_t) > LV_OBJ_STYLE_RESOLVED_CACHE_MEM_MAX) return NULL;
+
+        cache = lv_malloc(sizeof(lv_obj_style_resolved_cache_t));
+        if(cache == NULL) return NULL;
+
+        cache->gen = resolved_gen - 1;  /*Clear it below*/
+        ((lv_obj_t *)obj)->style_resolved_cache = cache;
+        resolved_obj_cnt++;
+        resolved_mem_used += sizeof(lv_obj_style_resolved_cache_t);
+    }
+
+    if(cache->gen != resolved_gen) {
+        lv_memzero(cache->entries, sizeof(cache->entries));
+        cache->gen = resolved_gen;
+    }
+
+    uint32_t id = ((uint32_t)prop + (part >> 16) * 31 + (uint32_t)obj->state * 7) % LV_OBJ_STYLE_RESOLVED_CACHE_SET_CNT;
+    return cache->entries[id];
+}
+#endif
+
+#if LV_ANIM_BATCH
+/**
+ * Invalidate an object for a drawing-only style change if it wasn't invalidated
+ * with the same area for such a change since the last refresh.
+ * This way animating e.g. the background color, border color and opacity of an object
+ * adds only one invalid area per frame.
+ * @param obj       pointer to an object
+ */
+static void invalidate_batched(lv_obj_t * obj)
+{
+    /*The same area as in `lv_obj_invalidate`*/
+    lv_area_t area;
+    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_copy(&area, &obj->coords);
+    lv_area_increase(&area, ext_size, ext_size);
+
+    uint32_t i;
+    for(i = 0; i < inv_batch_cnt; i++) {
+        if(inv_batch_objs[i] == obj && lv_area_is_equal(&inv_batch_areas[i], &area)) return;
+    }
+
+    lv_obj_invalidate_area(obj, &area);
+
+    /*If there is no more space, the next changes are simply invalidated again*/
+    if(inv_batch_cnt < LV_OBJ_STYLE_INV_BATCH_CNT) {
+        inv_batch_objs[inv_batch_cnt] = obj;
+        inv_batch_areas[inv_batch_cnt] = area;
+        inv_batch_cnt++;
+    }
+}
+#endif
@@ -84,6 +84,17 @@ typedef enum {
  */
 typedef uint32_t lv_style_selector_t;
 
+/**
+ * Statistics of the resolved style caches. See `LV_OBJ_STYLE_RESOLVED_CACHE_SIZE`.
+ */
+typedef struct {
+    uint32_t obj_cnt;           /**< Number of objects having a resolved style cache*/
+    uint32_t mem_used;          /**< Memory used by the caches in bytes*/
+    uint32_t mem_max;           /**< Upper limit of `mem_used`*/
+    uint32_t hit_cnt;           /**< Style property lookups served from a cache*/
+    uint32_t miss_cnt;          /**< Style property lookups which had to walk the styles*/
+} lv_obj_style_resolved_cache_info_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -197,6 +208,18 @@ void lv_obj_enable_style_refresh(bool en);
  */
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
 
+/**
+ * Get the memory usage and the hit rate of the resolved style caches.
+ * All fields are 0 if `LV_OBJ_STYLE_RESOLVED_CACHE_SIZE` is 0.
+ * @param info      store the result here
+ */
+void lv_obj_style_resolved_cache_get_info(lv_obj_style_resolved_cache_info_t * info);
+
+/**
+ * Reset the hit and miss counters of the resolved style caches.
+ */
+void lv_obj_style_resolved_cache_reset_stats(void);
+
 /**
  * Check if an object has a specified style property for a given style selector.
  * @param obj       pointer to an object
@@ -41,6 +41,23 @@ struct _lv_obj_style_transition_dsc_t {
     void * user_data;
 };
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+/*A property can be in one of the 2 entries of a set*/
+#define LV_OBJ_STYLE_RESOLVED_CACHE_SET_CNT ((LV_OBJ_STYLE_RESOLVED_CACHE_SIZE + 1) / 2)
+
+typedef struct {
+    lv_style_value_t value;
+    lv_style_prop_t prop;       /**< `LV_STYLE_PROP_INV` if the entry is empty*/
+    uint8_t part_id;            /**< The part shifted to the lowest byte*/
+    uint16_t state;
+} lv_obj_style_resolved_entry_t;
+
+struct _lv_obj_style_resolved_cache_t {
+    uint32_t gen;               /**< The entries are valid only if it equals to the global generation*/
+    lv_obj_style_resolved_entry_t entries[LV_OBJ_STYLE_RESOLVED_CACHE_SET_CNT][2];
+};
+#endif
+
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -85,6 +102,26 @@ lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state
  */
 void lv_obj_update_layer_type(lv_obj_t * obj);
 
+/**
+ * Mark the resolved style properties of all objects as outdated.
+ * Needs to be called when anything changes which can affect the final value of a style property
+ * (styles, states, parents). Does nothing if `LV_OBJ_STYLE_RESOLVED_CACHE_SIZE` is 0.
+ */
+void lv_obj_style_resolved_cache_invalidate(void);
+
+/**
+ * Free the resolved style cache of an object.
+ * @param obj       pointer to an object
+ */
+void lv_obj_style_resolved_cache_free(lv_obj_t * obj);
+
+/**
+ * Forget which objects were invalidated for drawing-only style changes in the current frame.
+ * Needs to be called when the invalidated areas are consumed or dropped (refresh, clearing the
+ * invalid areas) and when objects are deleted. Does nothing if `LV_ANIM_BATCH` is 0.
+ */
+void lv_obj_style_inv_batch_reset(void);
+
 /**********************
  *      MACROS
  **********************/
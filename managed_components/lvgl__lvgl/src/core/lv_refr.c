@@ -12,6 +12,7 @@
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../draw/lv_draw_mask_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_style_private.h"
 #include "lv_obj_event_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
@@ -40,6 +41,8 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static uint32_t get_area_cost(lv_display_t * disp, const lv_area_t * area);
+static void inv_area_join_cheapest(lv_display_t * disp, const lv_area_t * area);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
@@ -284,6 +287,7 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+        lv_obj_style_inv_batch_reset();
         return;
     }
 
@@ -323,14 +327,14 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
         if(lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
     }
 
-    /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
+    /*Save the area. If there is no place for it, join it to a saved one*/
+    if(disp->inv_p >= LV_INV_BUF_SIZE) {
+        inv_area_join_cheapest(disp, &com_area);
+    }
+    else {
+        lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
     }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
@@ -431,6 +435,7 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     disp_refr->inv_p = 0;
 
 refr_finish:
+    lv_obj_style_inv_batch_reset();
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_cleanup();
@@ -611,6 +616,7 @@ static void lv_refr_join_area(void)
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
+    bool has_cost_cb = disp_refr->area_cost_cb != NULL;
     for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
         if(disp_refr->inv_area_joined[join_in] != 0) continue;
 
@@ -621,16 +627,18 @@ static void lv_refr_join_area(void)
                 continue;
             }
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
+            /*Check if the areas are on each other.
+             *With a cost callback separate areas can be also cheaper to redraw together.*/
+            if(!has_cost_cb &&
+               lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
                 continue;
             }
 
             lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
+            /*Join two area only if the joined area is cheaper*/
+            if(get_area_cost(disp_refr, &joined_area) < (get_area_cost(disp_refr, &disp_refr->inv_areas[join_in]) +
+                                                         get_area_cost(disp_refr, &disp_refr->inv_areas[join_from]))) {
                 lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
 
                 /*Mark 'join_form' is joined into 'join_in'*/
@@ -641,6 +649,47 @@ static void lv_refr_join_area(void)
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Get the cost of redrawing an area
+ * @param disp      pointer to a display
+ * @param area      the area to check
+ * @return          the value returned by the display's `area_cost_cb` or the size of the area
+ */
+static uint32_t get_area_cost(lv_display_t * disp, const lv_area_t * area)
+{
+    if(disp->area_cost_cb) return disp->area_cost_cb(disp, area);
+    else return lv_area_get_size(area);
+}
+
+/**
+ * Join an area to the invalidated area whose cost increases the least.
+ * Used instead of adding a new invalidated area if there is no place for it.
+ * @param disp      pointer to a display
+ * @param area      the area to join
+ */
+static void inv_area_join_cheapest(lv_display_t * disp, const lv_area_t * area)
+{
+    LV_PROFILER_REFR_BEGIN;
+    uint32_t best_i = 0;
+    uint32_t best_diff = UINT32_MAX;
+    lv_area_t joined_area;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        lv_area_join(&joined_area, &disp->inv_areas[i], area);
+        uint32_t cost_joined = get_area_cost(disp, &joined_area);
+        uint32_t cost_ori = get_area_cost(disp, &disp->inv_areas[i]);
+        uint32_t diff = cost_joined > cost_ori ? cost_joined - cost_ori : 0;
+        if(diff < best_diff) {
+            best_diff = diff;
+            best_i = i;
+            if(diff == 0) break;
+        }
+    }
+
+    lv_area_join(&disp->inv_areas[best_i], &disp->inv_areas[best_i], area);
+    LV_PROFILER_REFR_END;
+}
+
 /**
  * Refresh the sync areas
  */
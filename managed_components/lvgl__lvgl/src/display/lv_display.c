@@ -11,6 +11,7 @@
 #include "../misc/lv_anim_private.h"
 #include "../draw/lv_draw_private.h"
 #include "../core/lv_obj_private.h"
+#include "../core/lv_obj_style_private.h"
 #include "lv_display.h"
 #include "../misc/lv_math.h"
 #include "../core/lv_refr_private.h"
@@ -551,6 +552,14 @@ void lv_display_set_flush_wait_cb(lv_display_t * disp, lv_display_flush_wait_cb_
     disp->flush_wait_cb = wait_cb;
 }
 
+void lv_display_set_area_cost_cb(lv_display_t * disp, lv_display_area_cost_cb_t cost_cb)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->area_cost_cb = cost_cb;
+}
+
 void lv_display_set_color_format(lv_display_t * disp, lv_color_format_t color_format)
 {
     if(disp == NULL) disp = lv_display_get_default();
@@ -1033,6 +1042,9 @@ void lv_display_enable_invalidation(lv_display_t * disp, bool en)
     }
 
     disp->inv_en_cnt += en ? 1 : -1;
+
+    /*Changes made while the invalidation was disabled weren't invalidated*/
+    lv_obj_style_inv_batch_reset();
 }
 
 bool lv_display_is_invalidation_enabled(lv_display_t * disp)
@@ -1271,6 +1283,7 @@ static void update_resolution(lv_display_t * disp)
     lv_memzero(disp->inv_areas, sizeof(disp->inv_areas));
     lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
+    lv_obj_style_inv_batch_reset();
     lv_obj_invalidate(disp->sys_layer);
 
     lv_obj_tree_walk(NULL, invalidate_layout_cb, NULL);
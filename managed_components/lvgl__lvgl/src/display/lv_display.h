@@ -81,6 +81,12 @@ typedef enum {
 typedef void (*lv_display_flush_cb_t)(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 typedef void (*lv_display_flush_wait_cb_t)(lv_display_t * disp);
 
+/**
+ * Estimate the cost of redrawing and flushing an area, e.g. a fixed overhead per flushed
+ * window plus the number of bytes to transfer. Only the relative values matter.
+ */
+typedef uint32_t (*lv_display_area_cost_cb_t)(lv_display_t * disp, const lv_area_t * area);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -323,6 +329,17 @@ void lv_display_set_flush_cb(lv_display_t * disp, lv_display_flush_cb_t flush_cb
  */
 void lv_display_set_flush_wait_cb(lv_display_t * disp, lv_display_flush_wait_cb_t wait_cb);
 
+/**
+ * Set a callback to estimate the cost of redrawing an area. The invalidated areas are
+ * joined if the cost of the joined area is less than the sum of their costs. If there are more
+ * than `LV_INV_BUF_SIZE` invalidated areas, the new area is joined to the one which
+ * increases the cost the least.
+ * If not set the number of pixels is used as cost and only overlapping areas are joined.
+ * @param disp      pointer to a display
+ * @param cost_cb   the callback to estimate the cost of an area, or NULL to use the default
+ */
+void lv_display_set_area_cost_cb(lv_display_t * disp, lv_display_area_cost_cb_t cost_cb);
+
 /**
  * Set the color format of the display.
  * @param disp              pointer to a display
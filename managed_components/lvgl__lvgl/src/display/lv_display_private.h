@@ -107,6 +107,9 @@ struct _lv_display_t {
     uint32_t inv_p;
     int32_t inv_en_cnt;
 
+    /** Estimate the cost of redrawing an area to decide which invalid areas to join. NULL: use the size*/
+    lv_display_area_cost_cb_t area_cost_cb;
+
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
 
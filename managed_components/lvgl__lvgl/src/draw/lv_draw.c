@@ -28,6 +28,11 @@
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+    #define ARENA_CHUNK_HEADER_SIZE LV_ALIGN_UP(sizeof(lv_draw_task_arena_chunk_t), 8)
+    #define ARENA_CHUNK_DATA_SIZE   LV_ALIGN_UP(LV_DRAW_TASK_ARENA_CHUNK_SIZE, 8)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -39,6 +44,14 @@ static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t
 static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
 static inline size_t get_draw_dsc_size(lv_draw_task_type_t type);
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer);
+static lv_draw_task_t * task_alloc(size_t size);
+static void task_free(lv_draw_task_t * t);
+#if LV_DRAW_TASK_GRID_LEVELS
+    static void grid_update(lv_layer_t * layer, lv_draw_task_t * t);
+    static void grid_remove(lv_layer_t * layer, lv_draw_task_t * t);
+    static void grid_delete(lv_layer_t * layer);
+    static bool grid_is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t draw_unit_id);
+#endif
 
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
@@ -81,6 +94,18 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+    lv_draw_task_arena_t * arena = &_draw_info.task_arena;
+    if(arena->live_cnt) LV_LOG_WARN("%" LV_PRIu32 " draw tasks are not freed", arena->live_cnt);
+    lv_draw_task_arena_chunk_t * chunk = arena->chunk_head;
+    while(chunk) {
+        lv_draw_task_arena_chunk_t * chunk_next = chunk->next;
+        lv_free(chunk);
+        chunk = chunk_next;
+    }
+    lv_memzero(arena, sizeof(lv_draw_task_arena_t));
+#endif
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -102,7 +127,7 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     LV_PROFILER_DRAW_BEGIN;
     size_t dsc_size = get_draw_dsc_size(type);
     LV_ASSERT_FORMAT_MSG(dsc_size > 0, "Draw task size is 0 for type %d", type);
-    lv_draw_task_t * new_task = lv_malloc_zeroed(LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
+    lv_draw_task_t * new_task = task_alloc(LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
     LV_ASSERT_MALLOC(new_task);
     new_task->area = *coords;
     new_task->_real_area = *coords;
@@ -115,17 +140,19 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     new_task->type = type;
     new_task->draw_dsc = (uint8_t *)new_task + LV_ALIGN_UP(sizeof(lv_draw_task_t), 8);
     new_task->state = LV_DRAW_TASK_STATE_WAITING;
+#if LV_DRAW_TASK_GRID_LEVELS
+    new_task->seq = layer->draw_task_seq;
+    layer->draw_task_seq++;
+#endif
 
-    /*Find the tail*/
+    /*Append to the tail*/
     if(layer->draw_task_head == NULL) {
         layer->draw_task_head = new_task;
     }
     else {
-        lv_draw_task_t * tail = layer->draw_task_head;
-        while(tail->next) tail = tail->next;
-
-        tail->next = new_task;
+        layer->draw_task_tail->next = new_task;
     }
+    layer->draw_task_tail = new_task;
 
     LV_PROFILER_DRAW_END;
     return new_task;
@@ -165,6 +192,9 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             }
             u = u->next;
         }
+#if LV_DRAW_TASK_GRID_LEVELS
+        grid_update(layer, t);
+#endif
         if(t->preferred_draw_unit_id == LV_DRAW_UNIT_NONE) {
             LV_LOG_WARN("the draw task was not taken by any units");
             t->state = LV_DRAW_TASK_STATE_FINISHED;
@@ -188,6 +218,9 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             }
             u = u->next;
         }
+#if LV_DRAW_TASK_GRID_LEVELS
+        grid_update(layer, t);
+#endif
     }
     LV_PROFILER_DRAW_END;
 }
@@ -242,6 +275,9 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
     while(t) {
         t_next = t->next;
         if(t->state == LV_DRAW_TASK_STATE_FINISHED) {
+#if LV_DRAW_TASK_GRID_LEVELS
+            grid_remove(layer, t);
+#endif
             cleanup_task(t, disp);
             remove_task = true;
             if(t_prev != NULL)
@@ -254,6 +290,13 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         }
         t = t_next;
     }
+    layer->draw_task_tail = t_prev;
+#if LV_DRAW_TASK_GRID_LEVELS
+    if(layer->draw_task_head == NULL) {
+        grid_delete(layer);
+        layer->draw_task_seq = 0;
+    }
+#endif
 
     bool task_dispatched = false;
 
@@ -365,6 +408,23 @@ lv_draw_task_t * lv_draw_get_next_available_task(lv_layer_t * layer, lv_draw_tas
     return NULL;
 }
 
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+void lv_draw_task_arena_get_stats(lv_draw_task_arena_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    *stats = _draw_info.task_arena.stats;
+}
+
+void lv_draw_task_arena_reset_stats(void)
+{
+    lv_draw_task_arena_t * arena = &_draw_info.task_arena;
+    uint32_t chunk_cnt = arena->stats.chunk_cnt;
+    lv_memzero(&arena->stats, sizeof(arena->stats));
+    arena->stats.chunk_cnt = chunk_cnt;
+    arena->stats.used_max = arena->used;
+}
+#endif
+
 uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check)
 {
     if(t_check == NULL) return 0;
@@ -550,6 +610,10 @@ void lv_draw_task_get_area(const lv_draw_task_t * t, lv_area_t * area)
  */
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t draw_unit_id)
 {
+#if LV_DRAW_TASK_GRID_LEVELS
+    if(t_check->in_grid) return grid_is_independent(layer, t_check, draw_unit_id);
+#endif
+
     LV_PROFILER_DRAW_BEGIN;
     lv_draw_task_t * t = layer->draw_task_head;
 
@@ -681,7 +745,7 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
         draw_label_dsc->text = NULL;
     }
 
-    lv_free(t);
+    task_free(t);
     LV_PROFILER_DRAW_END;
 }
 
@@ -713,3 +777,282 @@ static lv_draw_task_t * get_first_available_task(lv_layer_t * layer)
     LV_PROFILER_DRAW_END;
     return t;
 }
+
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+/**
+ * Allocate zeroed memory from the draw task arena.
+ * @param size      number of bytes to allocate
+ * @return          the allocated memory or NULL if it doesn't fit into a chunk or out of memory
+ */
+static void * arena_alloc(size_t size)
+{
+    lv_draw_task_arena_t * arena = &_draw_info.task_arena;
+    size = LV_ALIGN_UP(size, 8);
+    if(size > ARENA_CHUNK_DATA_SIZE) return NULL;
+
+    /*Step to the next chunk if the current one is full. Keep the chunks across frames so that
+     *after the first few frames no new chunks are needed.*/
+    if(arena->chunk_act == NULL || arena->chunk_ofs + size > ARENA_CHUNK_DATA_SIZE) {
+        lv_draw_task_arena_chunk_t * chunk = arena->chunk_act ? arena->chunk_act->next : arena->chunk_head;
+        if(chunk == NULL) {
+            chunk = lv_malloc(ARENA_CHUNK_HEADER_SIZE + ARENA_CHUNK_DATA_SIZE);
+            arena->stats.heap_alloc_cnt++;
+            if(chunk == NULL) return NULL;
+
+            chunk->next = NULL;
+            if(arena->chunk_act) arena->chunk_act->next = chunk;
+            else arena->chunk_head = chunk;
+            arena->stats.chunk_cnt++;
+        }
+        else {
+            /*The rest of the previous chunk is lost until the next rewind*/
+            if(arena->chunk_act) arena->used += ARENA_CHUNK_DATA_SIZE - arena->chunk_ofs;
+        }
+        arena->chunk_act = chunk;
+        arena->chunk_ofs = 0;
+    }
+
+    void * p = (uint8_t *)arena->chunk_act + ARENA_CHUNK_HEADER_SIZE + arena->chunk_ofs;
+    lv_memzero(p, size);
+    arena->chunk_ofs += size;
+    arena->used += size;
+    arena->live_cnt++;
+    if(arena->used > arena->stats.used_max) arena->stats.used_max = arena->used;
+    return p;
+}
+
+/**
+ * Release a memory allocated by `arena_alloc`.
+ * When the last one is released the arena is rewound.
+ * It happens at the latest when all draw tasks of a refreshed area are finished.
+ */
+static void arena_release(void)
+{
+    lv_draw_task_arena_t * arena = &_draw_info.task_arena;
+    LV_ASSERT(arena->live_cnt > 0);
+    arena->live_cnt--;
+    if(arena->live_cnt == 0) {
+        arena->chunk_act = arena->chunk_head;
+        arena->chunk_ofs = 0;
+        arena->used = 0;
+        arena->stats.reset_cnt++;
+    }
+}
+#endif /*LV_DRAW_TASK_ARENA_CHUNK_SIZE*/
+
+/**
+ * Allocate a zeroed draw task. Use the arena if the task fits into a chunk,
+ * else fall back to `lv_malloc`.
+ * @param size      size of the draw task and its draw descriptor
+ * @return          the allocated draw task or NULL on error
+ */
+static lv_draw_task_t * task_alloc(size_t size)
+{
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+    _draw_info.task_arena.stats.task_cnt++;
+    lv_draw_task_t * t = arena_alloc(size);
+    if(t) {
+        t->in_arena = 1;
+        return t;
+    }
+
+    _draw_info.task_arena.stats.heap_alloc_cnt++;
+#endif
+
+    return lv_malloc_zeroed(size);
+}
+
+/**
+ * Free a draw task allocated by `task_alloc`.
+ * @param t         the draw task to free
+ */
+static void task_free(lv_draw_task_t * t)
+{
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+    if(t->in_arena) {
+        arena_release();
+        return;
+    }
+#endif
+
+    lv_free(t);
+}
+
+#if LV_DRAW_TASK_GRID_LEVELS
+
+/**
+ * Get the range of cells on a level of the grid which are covered by an area.
+ * Coordinates outside of the grid are clamped to the edge cells.
+ * @param grid      pointer to a grid
+ * @param level     0: 1x1 cells, 1: 2x2 cells, 2: 4x4 cells, ...
+ * @param a         the area to convert to cells
+ * @param cells     store the first and last column (x) and row (y) here
+ */
+static void grid_get_cells(const lv_draw_task_grid_t * grid, uint32_t level, const lv_area_t * a, lv_area_t * cells)
+{
+    int32_t w = lv_area_get_width(&grid->area);
+    int32_t h = lv_area_get_height(&grid->area);
+    int32_t side = 1 << level;
+
+    int32_t x1 = LV_CLAMP(0, a->x1 - grid->area.x1, w - 1);
+    int32_t x2 = LV_CLAMP(0, a->x2 - grid->area.x1, w - 1);
+    int32_t y1 = LV_CLAMP(0, a->y1 - grid->area.y1, h - 1);
+    int32_t y2 = LV_CLAMP(0, a->y2 - grid->area.y1, h - 1);
+
+    cells->x1 = (x1 * side) / w;
+    cells->x2 = (x2 * side) / w;
+    cells->y1 = (y1 * side) / h;
+    cells->y2 = (y2 * side) / h;
+}
+
+/**
+ * Get the index of the first cell of a level in `cells`
+ */
+static inline uint32_t grid_level_ofs(uint32_t level)
+{
+    return ((1UL << (2 * level)) - 1) / 3;
+}
+
+/**
+ * Link a draw task into the finest cell which fully contains its `_real_area`
+ * @param grid      pointer to a grid
+ * @param t         the draw task to add
+ */
+static void grid_insert(lv_draw_task_grid_t * grid, lv_draw_task_t * t)
+{
+    uint32_t idx = 0;
+    int32_t level;
+    for(level = LV_DRAW_TASK_GRID_LEVELS - 1; level > 0; level--) {
+        lv_area_t cells;
+        grid_get_cells(grid, level, &t->_real_area, &cells);
+        if(cells.x1 == cells.x2 && cells.y1 == cells.y2) {
+            idx = grid_level_ofs(level) + cells.y1 * (1 << level) + cells.x1;
+            break;
+        }
+    }
+
+    t->grid_cell = (uint16_t)idx;
+    t->grid_prev = NULL;
+    t->grid_next = grid->cells[idx];
+    if(t->grid_next) t->grid_next->grid_prev = t;
+    grid->cells[idx] = t;
+    t->in_grid = 1;
+}
+
+/**
+ * Unlink a draw task from the grid of its layer if it's linked
+ * @param layer     the layer of the draw task
+ * @param t         the draw task to remove
+ */
+static void grid_remove(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    if(!t->in_grid) return;
+
+    if(t->grid_prev) t->grid_prev->grid_next = t->grid_next;
+    else layer->draw_task_grid->cells[t->grid_cell] = t->grid_next;
+    if(t->grid_next) t->grid_next->grid_prev = t->grid_prev;
+
+    t->grid_prev = NULL;
+    t->grid_next = NULL;
+    t->in_grid = 0;
+}
+
+/**
+ * Add a finalized draw task to the grid of its layer. Create the grid if the layer
+ * has many draw tasks. The draw task is (re)inserted as its area might have been
+ * changed in `LV_EVENT_DRAW_TASK_ADDED`.
+ * @param layer     the layer of the draw task
+ * @param t         the draw task which was finalized
+ */
+static void grid_update(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    lv_draw_task_grid_t * grid = layer->draw_task_grid;
+    if(grid) {
+        grid_remove(layer, t);
+        grid_insert(grid, t);
+        return;
+    }
+
+    /*With one draw unit the draw tasks are taken in order and `is_independent` is not used*/
+    if(_draw_info.unit_cnt < 2) return;
+    if(layer->draw_task_seq < LV_DRAW_TASK_GRID_MIN_TASKS) return;
+    if(lv_area_get_width(&layer->buf_area) <= 0 || lv_area_get_height(&layer->buf_area) <= 0) return;
+
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+    grid = arena_alloc(sizeof(lv_draw_task_grid_t));
+    if(grid) grid->in_arena = 1;
+    else grid = lv_malloc_zeroed(sizeof(lv_draw_task_grid_t));
+#else
+    grid = lv_malloc_zeroed(sizeof(lv_draw_task_grid_t));
+#endif
+    /*Not critical, the dependencies will be checked by scanning the draw tasks*/
+    if(grid == NULL) return;
+
+    grid->area = layer->buf_area;
+    layer->draw_task_grid = grid;
+
+    lv_draw_task_t * t_act = layer->draw_task_head;
+    while(t_act) {
+        grid_insert(grid, t_act);
+        t_act = t_act->next;
+    }
+}
+
+/**
+ * Free the grid of a layer. Should be called when the layer has no draw tasks.
+ * @param layer     the layer whose grid should be deleted
+ */
+static void grid_delete(lv_layer_t * layer)
+{
+    lv_draw_task_grid_t * grid = layer->draw_task_grid;
+    if(grid == NULL) return;
+
+    layer->draw_task_grid = NULL;
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+    if(grid->in_arena) {
+        arena_release();
+        return;
+    }
+#endif
+    lv_free(grid);
+}
+
+/**
+ * Same as `is_independent` but check only the draw tasks in the grid cells
+ * overlapping with `t_check`.
+ */
+static bool grid_is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t draw_unit_id)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    lv_draw_task_grid_t * grid = layer->draw_task_grid;
+    uint32_t level;
+    for(level = 0; level < LV_DRAW_TASK_GRID_LEVELS; level++) {
+        lv_area_t cells;
+        grid_get_cells(grid, level, &t_check->_real_area, &cells);
+        uint32_t ofs = grid_level_ofs(level);
+        int32_t side = 1 << level;
+        int32_t cx, cy;
+        for(cy = cells.y1; cy <= cells.y2; cy++) {
+            for(cx = cells.x1; cx <= cells.x2; cx++) {
+                lv_draw_task_t * t = grid->cells[ofs + cy * side + cx];
+                while(t) {
+                    /*Only the older draw tasks matter. The same draw tasks are skipped as in `is_independent`*/
+                    if(t->seq < t_check->seq &&
+                       t->state != LV_DRAW_TASK_STATE_FINISHED &&
+                       !(t->state == LV_DRAW_TASK_STATE_QUEUED && t->preferred_draw_unit_id == draw_unit_id)) {
+                        lv_area_t a;
+                        if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) {
+                            LV_PROFILER_DRAW_END;
+                            return false;
+                        }
+                    }
+                    t = t->grid_next;
+                }
+            }
+        }
+    }
+    LV_PROFILER_DRAW_END;
+    return true;
+}
+
+#endif /*LV_DRAW_TASK_GRID_LEVELS*/
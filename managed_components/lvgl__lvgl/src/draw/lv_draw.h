@@ -99,6 +99,18 @@ struct _lv_layer_t  {
     /** Linked list of draw tasks */
     lv_draw_task_t * draw_task_head;
 
+    /** Last element of `draw_task_head` to append new draw tasks in O(1).
+     * Valid only if `draw_task_head != NULL`. */
+    lv_draw_task_t * draw_task_tail;
+
+#if LV_DRAW_TASK_GRID_LEVELS
+    /** Spatial index of the draw tasks. Created when `draw_task_seq` reaches `LV_DRAW_TASK_GRID_MIN_TASKS`. */
+    lv_draw_task_grid_t * draw_task_grid;
+
+    /** Number of draw tasks added since the list of draw tasks was empty */
+    uint32_t draw_task_seq;
+#endif
+
     /** Parent layer */
     lv_layer_t * parent;
 
@@ -168,6 +180,26 @@ typedef struct {
     void * user_data;
 } lv_draw_dsc_base_t;
 
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+typedef struct {
+    /**Number of draw tasks allocated since the last `lv_draw_task_arena_reset_stats()`*/
+    uint32_t task_cnt;
+
+    /**Number of `lv_malloc` calls made for draw tasks in the same period
+     * (new arena chunks and draw tasks larger than a chunk)*/
+    uint32_t heap_alloc_cnt;
+
+    /**Number of times the arena was rewound in the same period*/
+    uint32_t reset_cnt;
+
+    /**Number of chunks owned by the arena*/
+    uint32_t chunk_cnt;
+
+    /**The most bytes used from the arena at once in the same period*/
+    uint32_t used_max;
+} lv_draw_task_arena_stats_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -272,6 +304,20 @@ lv_draw_task_t * lv_draw_get_next_available_task(lv_layer_t * layer, lv_draw_tas
  */
 uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check);
 
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+/**
+ * Get the allocation statistics of the draw task arena.
+ * After a few frames of a steady UI `heap_alloc_cnt` should stop growing.
+ * @param stats     store the statistics here
+ */
+void lv_draw_task_arena_get_stats(lv_draw_task_arena_stats_t * stats);
+
+/**
+ * Zero the counters of the draw task arena (`chunk_cnt` is kept).
+ */
+void lv_draw_task_arena_reset_stats(void);
+#endif
+
 
 /**
  * Send an event to the draw units
@@ -84,6 +84,25 @@ struct _lv_draw_task_t {
      */
     uint8_t preference_score;
 
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+    /** 1: allocated from the draw task arena, 0: allocated by `lv_malloc` */
+    uint8_t in_arena;
+#endif
+
+#if LV_DRAW_TASK_GRID_LEVELS
+    /** 1: linked into the `draw_task_grid` of `target_layer` */
+    uint8_t in_grid;
+
+    /** Index of the grid cell whose list contains this draw task */
+    uint16_t grid_cell;
+
+    /** Order of the draw task in the layer. Lower values were added earlier. */
+    uint32_t seq;
+
+    lv_draw_task_t * grid_prev;
+    lv_draw_task_t * grid_next;
+#endif
+
 };
 
 struct _lv_draw_mask_t {
@@ -182,6 +201,37 @@ struct _lv_draw_unit_t {
     void (*event_cb)(lv_event_t * event);
 };
 
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+typedef struct _lv_draw_task_arena_chunk_t {
+    struct _lv_draw_task_arena_chunk_t * next;
+} lv_draw_task_arena_chunk_t;
+
+typedef struct {
+    lv_draw_task_arena_chunk_t * chunk_head;
+    lv_draw_task_arena_chunk_t * chunk_act;     /**< Chunk to allocate from*/
+    uint32_t chunk_ofs;                         /**< First free byte in `chunk_act`*/
+    uint32_t used;                              /**< Bytes allocated since the last rewind*/
+    uint32_t live_cnt;                          /**< Draw tasks in the arena not freed yet*/
+    lv_draw_task_arena_stats_t stats;
+} lv_draw_task_arena_t;
+#endif
+
+#if LV_DRAW_TASK_GRID_LEVELS
+/** Number of cells in all levels: 1 + 4 + 16 + ... */
+#define LV_DRAW_TASK_GRID_CELL_CNT  (((1UL << (2 * LV_DRAW_TASK_GRID_LEVELS)) - 1) / 3)
+
+/**
+ * Each draw task is stored in the finest level whose single cell contains its `_real_area`.
+ * So the draw tasks overlapping an area can be found by checking only the cells
+ * overlapping that area on each level.
+ */
+struct _lv_draw_task_grid_t {
+    lv_area_t area;                 /**< Area covered by the grid. Draw tasks outside are clamped to the edge cells.*/
+    uint8_t in_arena;
+    lv_draw_task_t * cells[LV_DRAW_TASK_GRID_CELL_CNT];
+};
+#endif
+
 typedef struct {
     lv_draw_unit_t * unit_head;
     uint32_t unit_cnt;
@@ -193,6 +243,9 @@ typedef struct {
 #endif
     lv_mutex_t circle_cache_mutex;
     bool task_running;
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+    lv_draw_task_arena_t task_arena;
+#endif
 } lv_draw_global_info_t;
 
 /**********************
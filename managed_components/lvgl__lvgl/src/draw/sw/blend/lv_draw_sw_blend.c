@@ -54,6 +54,8 @@ static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_color(lv_color_f
 static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_image(lv_color_format_t layer_cf,
                                                                       lv_draw_sw_blend_image_dsc_t * image_dsc);
 
+static inline bool is_packed_mask(lv_color_format_t mask_format);
+
 
 /**********************
  *  STATIC VARIABLES
@@ -95,6 +97,8 @@ void lv_draw_sw_blend(lv_draw_task_t * t, const lv_draw_sw_blend_dsc_t * blend_d
         fill_dsc.opa = blend_dsc->opa;
         fill_dsc.color = blend_dsc->color;
         fill_dsc.mask_stride = 0;
+        fill_dsc.mask_format = LV_COLOR_FORMAT_A8;
+        fill_dsc.mask_bit_ofs = 0;
 
         if(blend_dsc->mask_buf == NULL) fill_dsc.mask_buf = NULL;
         else if(blend_dsc->mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) fill_dsc.mask_buf = NULL;
@@ -107,8 +111,19 @@ void lv_draw_sw_blend(lv_draw_task_t * t, const lv_draw_sw_blend_dsc_t * blend_d
                                                    blend_area.y1 - layer->buf_area.y1);
         if(fill_dsc.mask_buf) {
             fill_dsc.mask_stride = blend_dsc->mask_stride == 0  ? lv_area_get_width(blend_dsc->mask_area) : blend_dsc->mask_stride;
-            fill_dsc.mask_buf += fill_dsc.mask_stride * (blend_area.y1 - blend_dsc->mask_area->y1) +
-                                 (blend_area.x1 - blend_dsc->mask_area->x1);
+            if(is_packed_mask(blend_dsc->mask_format)) {
+                /*The stride is in pixels and the rows don't need to start on a byte boundary*/
+                uint32_t bpp = lv_color_format_get_bpp(blend_dsc->mask_format);
+                uint32_t bit_idx = (fill_dsc.mask_stride * (blend_area.y1 - blend_dsc->mask_area->y1) +
+                                    (blend_area.x1 - blend_dsc->mask_area->x1)) * bpp;
+                fill_dsc.mask_format = blend_dsc->mask_format;
+                fill_dsc.mask_buf += bit_idx >> 3;
+                fill_dsc.mask_bit_ofs = bit_idx & 0x7;
+            }
+            else {
+                fill_dsc.mask_buf += fill_dsc.mask_stride * (blend_area.y1 - blend_dsc->mask_area->y1) +
+                                     (blend_area.x1 - blend_dsc->mask_area->x1);
+            }
         }
 
         lv_draw_sw_blend_color(layer->color_format, &fill_dsc);
@@ -147,6 +162,7 @@ void lv_draw_sw_blend(lv_draw_task_t * t, const lv_draw_sw_blend_dsc_t * blend_d
 
         if(image_dsc.mask_buf) {
             LV_ASSERT_NULL(blend_dsc->mask_area);
+            LV_ASSERT_MSG(!is_packed_mask(blend_dsc->mask_format), "Packed masks are supported only for fills");
             image_dsc.mask_buf = blend_dsc->mask_buf;
             image_dsc.mask_stride = blend_dsc->mask_stride ? blend_dsc->mask_stride : lv_area_get_width(blend_dsc->mask_area);
             image_dsc.mask_buf += image_dsc.mask_stride * (blend_area.y1 - blend_dsc->mask_area->y1) +
@@ -280,4 +296,10 @@ static inline void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image(lv_color_format_
     }
 }
 
+static inline bool is_packed_mask(lv_color_format_t mask_format)
+{
+    return mask_format == LV_COLOR_FORMAT_A1 || mask_format == LV_COLOR_FORMAT_A2 ||
+           mask_format == LV_COLOR_FORMAT_A4;
+}
+
 #endif
@@ -42,7 +42,9 @@ struct _lv_draw_sw_blend_dsc_t {
     const lv_opa_t * mask_buf;      /**< NULL if ignored, or an alpha mask to apply on `blend_area`*/
     lv_draw_sw_mask_res_t mask_res; /**< The result of the previous mask operation */
     const lv_area_t * mask_area;    /**< The area of `mask_buf` with absolute coordinates*/
-    int32_t mask_stride;
+    int32_t mask_stride;            /**< Stride of `mask_buf` in bytes, or in pixels for packed masks*/
+    lv_color_format_t mask_format;  /**< LV_COLOR_FORMAT_A1/A2/A4 if `mask_buf` is packed (only for fills
+                                     *   on L8 and I1 layers), else `mask_buf` is A8*/
     lv_blend_mode_t blend_mode;     /**< E.g. LV_BLEND_MODE_ADDITIVE*/
 };
 
@@ -53,6 +55,8 @@ struct _lv_draw_sw_blend_fill_dsc_t {
     int32_t dest_stride;
     const lv_opa_t * mask_buf;
     int32_t mask_stride;
+    lv_color_format_t mask_format;  /**< LV_COLOR_FORMAT_A1/A2/A4 for packed masks, else LV_COLOR_FORMAT_A8*/
+    uint32_t mask_bit_ofs;          /**< Packed masks only: bit index of the first pixel in `mask_buf`*/
     lv_color_t color;
     lv_opa_t opa;
     lv_area_t relative_area;
@@ -79,6 +83,21 @@ struct _lv_draw_sw_blend_image_dsc_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Get a pixel of a packed mask as opacity. The pixels are stored from the MSB.
+ * The values are scaled as in `lv_font_fmt_txt` so the result is the same as with an A8 mask.
+ * @param buf       the packed mask
+ * @param bit_idx   index of the pixel's first bit in `buf`
+ * @param bpp       bits per pixel: 1, 2 or 4
+ * @return          the opacity of the pixel
+ */
+static inline lv_opa_t lv_draw_sw_blend_get_packed_mask(const uint8_t * buf, uint32_t bit_idx, uint32_t bpp)
+{
+    uint32_t max = (1 << bpp) - 1;
+    uint32_t v = (buf[bit_idx >> 3] >> (8 - bpp - (bit_idx & 0x7))) & max;
+    return (lv_opa_t)(v * (255 / max));
+}
+
 /**********************
  *      MACROS
  **********************/
@@ -36,6 +36,8 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static void /* LV_ATTRIBUTE_FAST_MEM */ packed_mask_blend(lv_draw_sw_blend_fill_dsc_t * dsc);
+
 static void /* LV_ATTRIBUTE_FAST_MEM */ i1_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
 
 #if LV_DRAW_SW_SUPPORT_L8
@@ -238,8 +240,12 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_i1(lv_draw_sw_blend_fill_ds
 
     int32_t bit_ofs = dsc->relative_area.x1 % 8;
 
+    /* Packed A1, A2 or A4 mask, e.g. the bitmap of a glyph */
+    if(mask && dsc->mask_format != LV_COLOR_FORMAT_A8) {
+        packed_mask_blend(dsc);
+    }
     /* Simple fill */
-    if(mask == NULL && opa >= LV_OPA_MAX) {
+    else if(mask == NULL && opa >= LV_OPA_MAX) {
         if(LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_I1(dsc)) {
             for(int32_t y = 0; y < h; y++) {
                 for(int32_t x = 0; x < w; x++) {
@@ -381,6 +387,49 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_i1(lv_draw_sw_blend_image_d
  *   STATIC FUNCTIONS
  **********************/
 
+static void LV_ATTRIBUTE_FAST_MEM packed_mask_blend(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const uint8_t * mask = dsc->mask_buf;
+    uint32_t bpp = lv_color_format_get_bpp(dsc->mask_format);
+    uint32_t mask_row_bits = dsc->mask_stride * bpp;
+    uint32_t mask_row_idx = dsc->mask_bit_ofs;
+    int32_t dest_stride = dsc->dest_stride;
+    uint8_t src_color = lv_color_luminance(dsc->color) / (I1_LUM_THRESHOLD + 1);
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+
+    for(int32_t y = 0; y < h; y++) {
+        uint32_t bit_idx = mask_row_idx;
+        for(int32_t x = 0; x < w; x++, bit_idx += bpp) {
+            uint8_t mask_val = lv_draw_sw_blend_get_packed_mask(mask, bit_idx, bpp);
+            if(mask_val == LV_OPA_TRANSP) continue;
+
+            /*Same as with A8 masks*/
+            uint8_t new_bit;
+            if(opa >= LV_OPA_MAX && mask_val == LV_OPA_COVER) {
+                new_bit = src_color;
+            }
+            else {
+                uint8_t current_bit = get_bit(dest_buf, x + bit_ofs);
+                uint8_t mix = opa >= LV_OPA_MAX ? mask_val : (mask_val * opa) / 255;
+                new_bit = (mix * src_color + (255 - mix) * current_bit) / 255;
+            }
+
+            if(new_bit) {
+                set_bit(dest_buf, x + bit_ofs);
+            }
+            else {
+                clear_bit(dest_buf, x + bit_ofs);
+            }
+        }
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        mask_row_idx += mask_row_bits;
+    }
+}
+
 static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
 {
     int32_t w = dsc->dest_w;
@@ -44,6 +44,8 @@
     static inline uint8_t /* LV_ATTRIBUTE_FAST_MEM */ get_bit(const uint8_t * buf, int32_t bit_idx);
 #endif
 
+static void /* LV_ATTRIBUTE_FAST_MEM */ packed_mask_blend(lv_draw_sw_blend_fill_dsc_t * dsc);
+
 static void /* LV_ATTRIBUTE_FAST_MEM */ l8_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
 
 #if LV_DRAW_SW_SUPPORT_AL88
@@ -207,8 +209,12 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_l8(lv_draw_sw_blend_fill_ds
     LV_UNUSED(mask_stride);
     LV_UNUSED(dest_stride);
 
+    /*Packed A1, A2 or A4 mask, e.g. the bitmap of a glyph*/
+    if(mask && dsc->mask_format != LV_COLOR_FORMAT_A8) {
+        packed_mask_blend(dsc);
+    }
     /*Simple fill*/
-    if(mask == NULL && opa >= LV_OPA_MAX) {
+    else if(mask == NULL && opa >= LV_OPA_MAX) {
         if(LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_L8(dsc)) {
             uint8_t color8 = lv_color_luminance(dsc->color);
             uint8_t * dest_buf = dsc->dest_buf;
@@ -339,6 +345,39 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_l8(lv_draw_sw_blend_image_d
  *   STATIC FUNCTIONS
  **********************/
 
+static void LV_ATTRIBUTE_FAST_MEM packed_mask_blend(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const uint8_t * mask = dsc->mask_buf;
+    uint32_t bpp = lv_color_format_get_bpp(dsc->mask_format);
+    uint32_t mask_row_bits = dsc->mask_stride * bpp;
+    uint32_t mask_row_idx = dsc->mask_bit_ofs;
+    int32_t dest_stride = dsc->dest_stride;
+    uint8_t color8 = lv_color_luminance(dsc->color);
+    uint8_t * dest_buf = dsc->dest_buf;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint32_t bit_idx = mask_row_idx;
+        if(opa >= LV_OPA_MAX) {
+            for(x = 0; x < w; x++, bit_idx += bpp) {
+                lv_color_8_8_mix(color8, &dest_buf[x], lv_draw_sw_blend_get_packed_mask(mask, bit_idx, bpp));
+            }
+        }
+        else {
+            for(x = 0; x < w; x++, bit_idx += bpp) {
+                lv_opa_t mask_opa = lv_draw_sw_blend_get_packed_mask(mask, bit_idx, bpp);
+                lv_color_8_8_mix(color8, &dest_buf[x], LV_OPA_MIX2(mask_opa, opa));
+            }
+        }
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        mask_row_idx += mask_row_bits;
+    }
+}
+
 #if LV_DRAW_SW_SUPPORT_I1
 static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
 {
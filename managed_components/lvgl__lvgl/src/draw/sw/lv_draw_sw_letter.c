@@ -26,6 +26,7 @@
 #include "../../misc/lv_area.h"
 #include "../../misc/lv_style.h"
 #include "../../font/lv_font.h"
+#include "../../font/lv_font_fmt_txt.h"
 #include "../../core/lv_refr_private.h"
 #include "../../stdlib/lv_string.h"
 
@@ -53,6 +54,8 @@ typedef struct {
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_cb(lv_draw_task_t * t, lv_draw_glyph_dsc_t * glyph_draw_dsc,
                                                        lv_draw_fill_dsc_t * fill_draw_dsc, const lv_area_t * fill_area);
 
+static lv_color_format_t get_packed_mask_format(lv_draw_task_t * t, const lv_font_glyph_dsc_t * g);
+
 #if LV_USE_FREETYPE && LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
 
     static void freetype_outline_event_cb(lv_event_t * e);
@@ -152,6 +155,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_task_t * t, lv_draw_gly
             case LV_FONT_GLYPH_FORMAT_IMAGE: {
                     if(glyph_draw_dsc->rotation % 3600 == 0 && glyph_draw_dsc->format != LV_FONT_GLYPH_FORMAT_IMAGE) {
                         lv_area_t mask_area = *glyph_draw_dsc->letter_coords;
+                        lv_color_format_t packed_mask_format = get_packed_mask_format(t, glyph_draw_dsc->g);
 
                         if(lv_font_has_static_bitmap(glyph_draw_dsc->g->resolved_font) &&
                            glyph_draw_dsc->g->format == LV_FONT_GLYPH_FORMAT_A8) {
@@ -168,6 +172,26 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_task_t * t, lv_draw_gly
                             blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
                             lv_draw_sw_blend(t, &blend_dsc);
                         }
+                        else if(packed_mask_format != LV_COLOR_FORMAT_UNKNOWN) {
+                            /*Blend the 1, 2 or 4 bpp bitmap directly, without expanding it to A8*/
+                            lv_font_glyph_dsc_t * g = glyph_draw_dsc->g;
+                            g->req_raw_bitmap = 1;
+                            const void * bitmap = lv_font_get_bitmap_fmt_txt(g, NULL);
+                            g->req_raw_bitmap = 0;
+                            if(bitmap == NULL) break;
+
+                            lv_draw_sw_blend_dsc_t blend_dsc;
+                            lv_memzero(&blend_dsc, sizeof(blend_dsc));
+                            blend_dsc.color = glyph_draw_dsc->color;
+                            blend_dsc.opa = glyph_draw_dsc->opa;
+                            blend_dsc.mask_buf = bitmap;
+                            blend_dsc.mask_area = &mask_area;
+                            blend_dsc.mask_format = packed_mask_format;
+                            blend_dsc.mask_stride = g->stride ? g->stride * 8 / g->format : g->box_w;
+                            blend_dsc.blend_area = glyph_draw_dsc->letter_coords;
+                            blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+                            lv_draw_sw_blend(t, &blend_dsc);
+                        }
                         else {
                             glyph_draw_dsc->glyph_data = lv_font_get_glyph_bitmap(glyph_draw_dsc->g, glyph_draw_dsc->_draw_buf);
                             if(glyph_draw_dsc->glyph_data == NULL) {
@@ -224,6 +248,43 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_task_t * t, lv_draw_gly
     }
 }
 
+/**
+ * Check if the bitmap of a glyph can be used as a packed blend mask on the target layer.
+ * Only the uncompressed bitmaps of the built-in font format are packed as the blend expects.
+ * @param t     the draw task
+ * @param g     the glyph descriptor
+ * @return      LV_COLOR_FORMAT_A1/A2/A4 or LV_COLOR_FORMAT_UNKNOWN if the bitmap needs to be expanded
+ */
+static lv_color_format_t get_packed_mask_format(lv_draw_task_t * t, const lv_font_glyph_dsc_t * g)
+{
+    lv_color_format_t cf = t->target_layer->color_format;
+    bool layer_ok = false;
+#if LV_DRAW_SW_SUPPORT_L8
+    if(cf == LV_COLOR_FORMAT_L8) layer_ok = true;
+#endif
+#if LV_DRAW_SW_SUPPORT_I1
+    if(cf == LV_COLOR_FORMAT_I1) layer_ok = true;
+#endif
+    /*A custom blend handler gets the blend descriptor as it is*/
+    if(!layer_ok || lv_draw_sw_get_blend_handler(cf)) return LV_COLOR_FORMAT_UNKNOWN;
+
+    const lv_font_t * font = g->resolved_font;
+    if(font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt) return LV_COLOR_FORMAT_UNKNOWN;
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    if(fdsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN) return LV_COLOR_FORMAT_UNKNOWN;
+
+    switch(g->format) {
+        case LV_FONT_GLYPH_FORMAT_A1:
+            return LV_COLOR_FORMAT_A1;
+        case LV_FONT_GLYPH_FORMAT_A2:
+            return LV_COLOR_FORMAT_A2;
+        case LV_FONT_GLYPH_FORMAT_A4:
+            return LV_COLOR_FORMAT_A4;
+        default:
+            return LV_COLOR_FORMAT_UNKNOWN;
+    }
+}
+
 #if LV_USE_FREETYPE && LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
 
 /*
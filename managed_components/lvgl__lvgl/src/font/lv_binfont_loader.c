@@ -117,6 +117,15 @@ lv_font_t * lv_binfont_create(const char * path)
 
     lv_fs_close(&file);
 
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+    /*Without the tables the glyphs are still found by binary search*/
+    if(font) lv_font_fmt_txt_cmap_index_create(font);
+#endif
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+    if(font) lv_font_fmt_txt_kern_index_create(font);
+#endif
+
     return font;
 }
 
@@ -137,6 +146,19 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+#if LV_FONT_GLYPH_CACHE_SIZE
+    /*The cached glyphs refer to the font's descriptor*/
+    lv_font_fmt_txt_glyph_cache_drop_all();
+#endif
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+    lv_font_fmt_txt_cmap_index_delete(font);
+#endif
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+    lv_font_fmt_txt_kern_index_delete(font);
+#endif
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
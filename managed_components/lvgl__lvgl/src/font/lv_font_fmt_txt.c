@@ -13,6 +13,7 @@
 #include "../misc/lv_types.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
+#include "../misc/cache/lv_cache.h"
 #include "../stdlib/lv_mem.h"
 
 /*********************
@@ -22,6 +23,22 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_GLYPH_CACHE_SIZE
+    #define glyph_cache_p (LV_GLOBAL_DEFAULT()->font_glyph_cache)
+    #define glyph_cache_stats (LV_GLOBAL_DEFAULT()->font_glyph_cache_stats)
+    #define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+#endif /*LV_FONT_GLYPH_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+    #define cmap_index_ll_p &(LV_GLOBAL_DEFAULT()->font_cmap_index_ll)
+    #define cmap_index_last (LV_GLOBAL_DEFAULT()->font_cmap_index_last)
+#endif /*LV_FONT_FMT_TXT_CMAP_INDEX*/
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+    #define kern_index_ll_p &(LV_GLOBAL_DEFAULT()->font_kern_index_ll)
+    #define kern_index_last (LV_GLOBAL_DEFAULT()->font_kern_index_last)
+#endif /*LV_FONT_FMT_TXT_KERN_INDEX*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,14 +47,49 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+#if LV_FONT_GLYPH_CACHE_SIZE
+typedef struct {
+    lv_cache_slot_size_t slot;
+
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    uint32_t gid;
+
+    lv_draw_buf_t * draw_buf;   /*The expanded A8 bitmap*/
+} glyph_cache_data_t;
+#endif /*LV_FONT_GLYPH_CACHE_SIZE*/
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static int32_t get_sparse_ofs(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t cmap_i, uint32_t rcp);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
 static int kern_pair_16_compare(const void * ref, const void * element);
+static const void * expand_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                                 uint32_t stride_in, lv_draw_buf_t * draw_buf);
+
+#if LV_FONT_GLYPH_CACHE_SIZE
+    static const void * get_cached_glyph(lv_font_glyph_dsc_t * g_dsc, const lv_font_fmt_txt_dsc_t * fdsc,
+                                         const lv_font_fmt_txt_glyph_dsc_t * gdsc);
+    static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
+    static uint32_t glyph_cache_hash_cb(const glyph_cache_data_t * data);
+    static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data);
+#endif /*LV_FONT_GLYPH_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+    static lv_font_fmt_txt_cmap_index_t * find_cmap_index(const lv_font_fmt_txt_dsc_t * fdsc);
+    static bool build_cmap_lut(const lv_font_fmt_txt_cmap_t * cmap, lv_font_fmt_txt_cmap_lut_t * lut, uint32_t * size);
+    static void free_cmap_index(lv_font_fmt_txt_cmap_index_t * index);
+    static inline uint32_t popcount32(uint32_t v);
+#endif /*LV_FONT_FMT_TXT_CMAP_INDEX*/
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+    static lv_font_fmt_txt_kern_index_t * find_kern_index(const lv_font_fmt_txt_dsc_t * fdsc);
+    static bool build_kern_index(lv_font_fmt_txt_kern_index_t * index, const lv_font_fmt_txt_kern_pair_t * kdsc);
+    static inline uint32_t kern_index_get_slot(const lv_font_fmt_txt_kern_index_t * index, uint32_t key);
+#endif /*LV_FONT_FMT_TXT_KERN_INDEX*/
 
 #if LV_USE_FONT_COMPRESSED
     static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter);
@@ -99,12 +151,290 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 
     if(g_dsc->req_raw_bitmap) return &fdsc->glyph_bitmap[gdsc->bitmap_index];
 
-    uint8_t * bitmap_out = draw_buf->data;
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
-    uint32_t stride_in = g_dsc->stride;
+#if LV_FONT_GLYPH_CACHE_SIZE
+    /*Plain A8 glyphs are only copied, it's not worth caching them*/
+    if(fdsc->bpp != 8 || fdsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN) {
+        const void * cached = get_cached_glyph(g_dsc, fdsc, gdsc);
+        if(cached) return cached;
+    }
+#endif
+
+    return expand_glyph(fdsc, gdsc, g_dsc->stride, draw_buf);
+}
+
+#if LV_FONT_GLYPH_CACHE_SIZE
+
+void lv_font_fmt_txt_glyph_cache_init(void)
+{
+    if(glyph_cache_p != NULL) return;
+
+    glyph_cache_p = lv_cache_create(&lv_cache_class_lru_ht_size, sizeof(glyph_cache_data_t), LV_FONT_GLYPH_CACHE_SIZE,
+    (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)glyph_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)glyph_cache_free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)glyph_cache_hash_cb,
+    });
+    lv_cache_set_name(glyph_cache_p, "FONT_GLYPH");
+}
+
+void lv_font_fmt_txt_glyph_cache_deinit(void)
+{
+    lv_cache_destroy(glyph_cache_p, NULL);
+    glyph_cache_p = NULL;
+}
+
+void lv_font_fmt_txt_release_glyph(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_UNUSED(font);
+
+    if(g_dsc->entry == NULL) return;
+    lv_cache_release(glyph_cache_p, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+}
+
+void lv_font_fmt_txt_glyph_cache_get_stats(lv_font_glyph_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    *stats = glyph_cache_stats;
+}
+
+void lv_font_fmt_txt_glyph_cache_reset_stats(void)
+{
+    lv_memzero(&glyph_cache_stats, sizeof(lv_font_glyph_cache_stats_t));
+}
+
+void lv_font_fmt_txt_glyph_cache_drop_all(void)
+{
+    if(glyph_cache_p == NULL) return;
+    lv_cache_drop_all(glyph_cache_p, NULL);
+}
+
+#endif /*LV_FONT_GLYPH_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+
+void lv_font_fmt_txt_cmap_index_init(void)
+{
+    lv_ll_init(cmap_index_ll_p, sizeof(lv_font_fmt_txt_cmap_index_t));
+    cmap_index_last = NULL;
+}
+
+void lv_font_fmt_txt_cmap_index_deinit(void)
+{
+    lv_font_fmt_txt_cmap_index_t * index;
+    LV_LL_READ(cmap_index_ll_p, index) {
+        free_cmap_index(index);
+    }
+    lv_ll_clear(cmap_index_ll_p);
+    cmap_index_last = NULL;
+}
+
+lv_result_t lv_font_fmt_txt_cmap_index_create(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    if(font->get_glyph_dsc != lv_font_get_glyph_dsc_fmt_txt) return LV_RESULT_INVALID;
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    if(find_cmap_index(fdsc)) return LV_RESULT_OK;
+
+    lv_font_fmt_txt_cmap_lut_t * luts = lv_malloc_zeroed(fdsc->cmap_num * sizeof(lv_font_fmt_txt_cmap_lut_t));
+    if(luts == NULL) return LV_RESULT_INVALID;
+
+    lv_font_fmt_txt_cmap_index_t * index = lv_ll_ins_head(cmap_index_ll_p);
+    if(index == NULL) {
+        lv_free(luts);
+        return LV_RESULT_INVALID;
+    }
+    index->fdsc = fdsc;
+    index->luts = luts;
+    index->size = fdsc->cmap_num * sizeof(lv_font_fmt_txt_cmap_lut_t);
+
+    uint32_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        if(!build_cmap_lut(&fdsc->cmaps[i], &luts[i], &index->size)) {
+            lv_font_fmt_txt_cmap_index_delete(font);
+            LV_LOG_WARN("Couldn't allocate the cmap lookup tables");
+            return LV_RESULT_INVALID;
+        }
+    }
+
+    LV_LOG_INFO("cmap lookup tables use %" LV_PRIu32 " bytes", index->size);
+
+    return LV_RESULT_OK;
+}
+
+void lv_font_fmt_txt_cmap_index_delete(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    lv_font_fmt_txt_cmap_index_t * index = find_cmap_index(font->dsc);
+    if(index == NULL) return;
+
+    free_cmap_index(index);
+    lv_ll_remove(cmap_index_ll_p, index);
+    lv_free(index);
+    cmap_index_last = NULL;
+}
+
+uint32_t lv_font_fmt_txt_cmap_index_get_size(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    lv_font_fmt_txt_cmap_index_t * index = find_cmap_index(font->dsc);
+    return index ? index->size : 0;
+}
+
+#endif /*LV_FONT_FMT_TXT_CMAP_INDEX*/
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+
+void lv_font_fmt_txt_kern_index_init(void)
+{
+    lv_ll_init(kern_index_ll_p, sizeof(lv_font_fmt_txt_kern_index_t));
+    kern_index_last = NULL;
+}
+
+void lv_font_fmt_txt_kern_index_deinit(void)
+{
+    lv_font_fmt_txt_kern_index_t * index;
+    LV_LL_READ(kern_index_ll_p, index) {
+        lv_free(index->keys);
+        lv_free(index->values);
+    }
+    lv_ll_clear(kern_index_ll_p);
+    kern_index_last = NULL;
+}
+
+lv_result_t lv_font_fmt_txt_kern_index_create(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    if(font->get_glyph_dsc != lv_font_get_glyph_dsc_fmt_txt) return LV_RESULT_INVALID;
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    if(fdsc->kern_dsc == NULL || fdsc->kern_classes) return LV_RESULT_OK;
+    if(find_kern_index(fdsc)) return LV_RESULT_OK;
+
+    const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+    if(kdsc->glyph_ids_size > 1 || kdsc->pair_cnt == 0) return LV_RESULT_OK;
+
+    lv_font_fmt_txt_kern_index_t * index = lv_ll_ins_head(kern_index_ll_p);
+    if(index == NULL) return LV_RESULT_INVALID;
+    lv_memzero(index, sizeof(lv_font_fmt_txt_kern_index_t));
+    index->fdsc = fdsc;
+
+    if(!build_kern_index(index, kdsc)) {
+        lv_font_fmt_txt_kern_index_delete(font);
+        LV_LOG_WARN("Couldn't allocate the kerning hash table");
+        return LV_RESULT_INVALID;
+    }
+
+    LV_LOG_INFO("kerning hash table of %" LV_PRIu32 " pairs uses %" LV_PRIu32 " bytes",
+                (uint32_t)kdsc->pair_cnt, index->size);
 
+    return LV_RESULT_OK;
+}
+
+void lv_font_fmt_txt_kern_index_delete(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    lv_font_fmt_txt_kern_index_t * index = find_kern_index(font->dsc);
+    if(index == NULL) return;
+
+    lv_free(index->keys);
+    lv_free(index->values);
+    lv_ll_remove(kern_index_ll_p, index);
+    lv_free(index);
+    kern_index_last = NULL;
+}
+
+uint32_t lv_font_fmt_txt_kern_index_get_size(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    lv_font_fmt_txt_kern_index_t * index = find_kern_index(font->dsc);
+    return index ? index->size : 0;
+}
+
+#endif /*LV_FONT_FMT_TXT_KERN_INDEX*/
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                                   uint32_t unicode_letter_next)
+{
+    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
+    bool is_tab = unicode_letter == '\t';
+    if(is_tab) {
+        unicode_letter = ' ';
+    }
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    if(!gid) return false;
+
+    int8_t kvalue = 0;
+    if(fdsc->kern_dsc) {
+        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
+        if(gid_next) {
+            kvalue = get_kern_value(font, gid, gid_next);
+        }
+    }
+
+    /*Put together a glyph dsc*/
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+
+    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+
+    uint32_t adv_w = gdsc->adv_w;
+    if(is_tab) adv_w *= 2;
+
+    adv_w += kv;
+    adv_w  = (adv_w + (1 << 3)) >> 4;
+
+    dsc_out->adv_w = adv_w;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->box_w = gdsc->box_w;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+
+    if(fdsc->stride == 0) dsc_out->stride = 0;
+    else {
+        /*E.g. w = 5, bpp = 2, means 2 bytes/line*/
+        uint32_t bit_count = dsc_out->box_w * fdsc->bpp;
+        uint32_t width_in_bytes = (bit_count + 7) >> 3; /*No division round up*/
+
+        /*E.g. font_dsc stride == 4 means align to 4 byte boundary.
+         *In glyph_dsc store the actual line length in bytes*/
+        dsc_out->stride = LV_ROUND_UP(width_in_bytes, fdsc->stride);
+    }
+
+    dsc_out->format = (uint8_t)fdsc->bpp;
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = gid;
+
+    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Expand a glyph to A8.
+ * @param fdsc          the font descriptor
+ * @param gdsc          the glyph descriptor
+ * @param stride_in     the stride of the glyph's bitmap or 0 if the lines are not padded
+ * @param draw_buf      store the A8 bitmap here
+ * @return              `draw_buf` or NULL on error
+ */
+static const void * expand_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                                 uint32_t stride_in, lv_draw_buf_t * draw_buf)
+{
+    uint8_t * bitmap_out = draw_buf->data;
 
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
         const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
@@ -219,67 +549,6 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
     return NULL;
 }
 
-bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
-                                   uint32_t unicode_letter_next)
-{
-    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
-    bool is_tab = unicode_letter == '\t';
-    if(is_tab) {
-        unicode_letter = ' ';
-    }
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
-    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
-    if(!gid) return false;
-
-    int8_t kvalue = 0;
-    if(fdsc->kern_dsc) {
-        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
-        if(gid_next) {
-            kvalue = get_kern_value(font, gid, gid_next);
-        }
-    }
-
-    /*Put together a glyph dsc*/
-    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
-
-    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
-
-    uint32_t adv_w = gdsc->adv_w;
-    if(is_tab) adv_w *= 2;
-
-    adv_w += kv;
-    adv_w  = (adv_w + (1 << 3)) >> 4;
-
-    dsc_out->adv_w = adv_w;
-    dsc_out->box_h = gdsc->box_h;
-    dsc_out->box_w = gdsc->box_w;
-    dsc_out->ofs_x = gdsc->ofs_x;
-    dsc_out->ofs_y = gdsc->ofs_y;
-
-    if(fdsc->stride == 0) dsc_out->stride = 0;
-    else {
-        /*E.g. w = 5, bpp = 2, means 2 bytes/line*/
-        uint32_t bit_count = dsc_out->box_w * fdsc->bpp;
-        uint32_t width_in_bytes = (bit_count + 7) >> 3; /*No division round up*/
-
-        /*E.g. font_dsc stride == 4 means align to 4 byte boundary.
-         *In glyph_dsc store the actual line length in bytes*/
-        dsc_out->stride = LV_ROUND_UP(width_in_bytes, fdsc->stride);
-    }
-
-    dsc_out->format = (uint8_t)fdsc->bpp;
-    dsc_out->is_placeholder = false;
-    dsc_out->gid.index = gid;
-
-    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
-
-    return true;
-}
-
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
     if(letter == '\0') return 0;
@@ -305,22 +574,14 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
             glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_8[rcp];
         }
         else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
-            uint16_t key = rcp;
-            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
-                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
-
-            if(p) {
-                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
+            int32_t ofs = get_sparse_ofs(fdsc, i, rcp);
+            if(ofs >= 0) {
                 glyph_id = fdsc->cmaps[i].glyph_id_start + (uint32_t) ofs;
             }
         }
         else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
-            uint16_t key = rcp;
-            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
-                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
-
-            if(p) {
-                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
+            int32_t ofs = get_sparse_ofs(fdsc, i, rcp);
+            if(ofs >= 0) {
                 const uint16_t * gid_ofs_16 = fdsc->cmaps[i].glyph_id_ofs_list;
                 glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_16[ofs];
             }
@@ -333,6 +594,42 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
 }
 
+/**
+ * Find a code point in the `unicode_list` of a sparse cmap.
+ * @param fdsc      the font descriptor
+ * @param cmap_i    index of the cmap
+ * @param rcp       the code point relative to the `range_start` of the cmap
+ * @return          index in `unicode_list` or -1 if not found
+ */
+static int32_t get_sparse_ofs(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t cmap_i, uint32_t rcp)
+{
+    const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[cmap_i];
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+    lv_font_fmt_txt_cmap_index_t * index = find_cmap_index(fdsc);
+    if(index) {
+        const lv_font_fmt_txt_cmap_lut_t * lut = &index->luts[cmap_i];
+        if(rcp > 0xFFFF) return -1;
+        uint32_t page_id = lut->page_ids[rcp >> 8];
+        if(page_id == LV_FONT_FMT_TXT_CMAP_PAGE_NONE) return -1;
+
+        const lv_font_fmt_txt_cmap_page_t * page = &lut->pages[page_id];
+        uint32_t w = (rcp >> 5) & 0x7;
+        uint32_t bit = 1u << (rcp & 0x1F);
+        if((page->bits[w] & bit) == 0) return -1;
+
+        return page->base + page->word_base[w] + popcount32(page->bits[w] & (bit - 1));
+    }
+#endif
+
+    uint16_t key = rcp;
+    uint16_t * p = lv_utils_bsearch(&key, cmap->unicode_list, cmap->list_length,
+                                    sizeof(cmap->unicode_list[0]), unicode_list_compare);
+    if(p == NULL) return -1;
+
+    return (int32_t)(p - cmap->unicode_list);
+}
+
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
 {
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
@@ -342,6 +639,16 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     if(fdsc->kern_classes == 0) {
         /*Kern pairs*/
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+#if LV_FONT_FMT_TXT_KERN_INDEX
+        const lv_font_fmt_txt_kern_index_t * index = find_kern_index(fdsc);
+        if(index) {
+            /*The glyph IDs of the pairs are at most 16 bit*/
+            if(gid_left > 0xFFFF || gid_right > 0xFFFF) return 0;
+            uint32_t key = (gid_left << 16) | gid_right;
+            uint32_t slot = kern_index_get_slot(index, key);
+            return index->keys[slot] == key ? index->values[slot] : 0;
+        }
+#endif
         if(kdsc->glyph_ids_size == 0) {
             /*Use binary search to find the kern value.
              *The pairs are ordered left_id first, then right_id secondly.*/
@@ -409,6 +716,257 @@ static int kern_pair_16_compare(const void * ref, const void * element)
     else return ref16_p->gid_right - element16_p[1];
 }
 
+#if LV_FONT_GLYPH_CACHE_SIZE
+
+/**
+ * Get the expanded glyph from the cache or expand it and add it to the cache.
+ * The entry is stored in `g_dsc->entry` and released by `lv_font_fmt_txt_release_glyph`.
+ * @param g_dsc     the glyph descriptor
+ * @param fdsc      the font descriptor
+ * @param gdsc      the glyph descriptor of the font
+ * @return          a draw buffer with the A8 bitmap or NULL if the glyph can't be cached
+ */
+static const void * get_cached_glyph(lv_font_glyph_dsc_t * g_dsc, const lv_font_fmt_txt_dsc_t * fdsc,
+                                     const lv_font_fmt_txt_glyph_dsc_t * gdsc)
+{
+    if(glyph_cache_p == NULL) return NULL;
+
+    glyph_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.fdsc = fdsc;
+    search_key.gid = g_dsc->gid.index;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(glyph_cache_p, &search_key, NULL);
+    if(entry) {
+        glyph_cache_stats.hit_cnt++;
+        g_dsc->entry = entry;
+        return ((glyph_cache_data_t *)lv_cache_entry_get_data(entry))->draw_buf;
+    }
+
+    glyph_cache_stats.miss_cnt++;
+
+    uint32_t data_size = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8) * gdsc->box_h;
+    if(data_size > LV_FONT_GLYPH_CACHE_SIZE) return NULL;
+
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, gdsc->box_w, gdsc->box_h,
+                                                     LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if(draw_buf == NULL) return NULL;
+
+    if(expand_glyph(fdsc, gdsc, g_dsc->stride, draw_buf) == NULL) {
+        lv_draw_buf_destroy(draw_buf);
+        return NULL;
+    }
+
+    search_key.slot.size = draw_buf->data_size;
+    search_key.draw_buf = draw_buf;
+    entry = lv_cache_add(glyph_cache_p, &search_key, NULL);
+    if(entry == NULL) {
+        lv_draw_buf_destroy(draw_buf);
+        return NULL;
+    }
+
+    g_dsc->entry = entry;
+    return draw_buf;
+}
+
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
+{
+    if(lhs->fdsc != rhs->fdsc) return lhs->fdsc > rhs->fdsc ? 1 : -1;
+    if(lhs->gid != rhs->gid) return lhs->gid > rhs->gid ? 1 : -1;
+    return 0;
+}
+
+static uint32_t glyph_cache_hash_cb(const glyph_cache_data_t * data)
+{
+    return ((uint32_t)(uintptr_t)data->fdsc ^ (data->gid * 2654435761u)) * 2246822519u;
+}
+
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_draw_buf_destroy(data->draw_buf);
+}
+
+#endif /*LV_FONT_GLYPH_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+
+static lv_font_fmt_txt_cmap_index_t * find_cmap_index(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    /*Usually the characters of the same font are looked up one after the other*/
+    if(cmap_index_last && cmap_index_last->fdsc == fdsc) return cmap_index_last;
+
+    lv_font_fmt_txt_cmap_index_t * index;
+    LV_LL_READ(cmap_index_ll_p, index) {
+        if(index->fdsc == fdsc) {
+            cmap_index_last = index;
+            return index;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Build the lookup table of a sparse cmap. Nothing is allocated for the other cmaps.
+ * @param cmap      the cmap
+ * @param lut       store the table here
+ * @param size      the size of the allocated memory is added to it
+ * @return          false: out of memory
+ */
+static bool build_cmap_lut(const lv_font_fmt_txt_cmap_t * cmap, lv_font_fmt_txt_cmap_lut_t * lut, uint32_t * size)
+{
+    if(cmap->type != LV_FONT_FMT_TXT_CMAP_SPARSE_TINY && cmap->type != LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) return true;
+
+    /*The relative code points are `uint16_t` so there are at most 256 pages*/
+    uint32_t page_cnt = (LV_MIN(cmap->range_length, 0x10000) + 0xFF) >> 8;
+
+    /*`unicode_list` is sorted so the code points of a page are next to each other*/
+    uint32_t used_cnt = 0;
+    uint32_t prev_page = UINT32_MAX;
+    uint32_t i;
+    for(i = 0; i < cmap->list_length; i++) {
+        uint32_t page = cmap->unicode_list[i] >> 8;
+        if(page >= page_cnt) break;
+        if(page != prev_page) used_cnt++;
+        prev_page = page;
+    }
+
+    lut->page_ids = lv_malloc(page_cnt * sizeof(uint16_t));
+    lut->pages = used_cnt ? lv_malloc_zeroed(used_cnt * sizeof(lv_font_fmt_txt_cmap_page_t)) : NULL;
+    if(lut->page_ids == NULL || (used_cnt && lut->pages == NULL)) return false;
+    *size += page_cnt * sizeof(uint16_t) + used_cnt * sizeof(lv_font_fmt_txt_cmap_page_t);
+
+    lv_memset(lut->page_ids, 0xFF, page_cnt * sizeof(uint16_t));
+
+    used_cnt = 0;
+    prev_page = UINT32_MAX;
+    lv_font_fmt_txt_cmap_page_t * page_p = NULL;
+    for(i = 0; i < cmap->list_length; i++) {
+        uint32_t rcp = cmap->unicode_list[i];
+        uint32_t page = rcp >> 8;
+        if(page >= page_cnt) break;
+        if(page != prev_page) {
+            lut->page_ids[page] = (uint16_t)used_cnt;
+            page_p = &lut->pages[used_cnt];
+            page_p->base = (uint16_t)i;
+            used_cnt++;
+            prev_page = page;
+        }
+        page_p->bits[(rcp >> 5) & 0x7] |= 1u << (rcp & 0x1F);
+    }
+
+    for(i = 0; i < used_cnt; i++) {
+        uint32_t cnt = 0;
+        uint32_t w;
+        for(w = 0; w < 8; w++) {
+            lut->pages[i].word_base[w] = (uint8_t)cnt;
+            cnt += popcount32(lut->pages[i].bits[w]);
+        }
+    }
+
+    return true;
+}
+
+static void free_cmap_index(lv_font_fmt_txt_cmap_index_t * index)
+{
+    uint32_t i;
+    for(i = 0; i < index->fdsc->cmap_num; i++) {
+        lv_free(index->luts[i].page_ids);
+        lv_free(index->luts[i].pages);
+    }
+    lv_free(index->luts);
+}
+
+static inline uint32_t popcount32(uint32_t v)
+{
+    v = v - ((v >> 1) & 0x55555555);
+    v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
+    return (((v + (v >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+}
+
+#endif /*LV_FONT_FMT_TXT_CMAP_INDEX*/
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+
+static lv_font_fmt_txt_kern_index_t * find_kern_index(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    /*The kerning of the letters of the same text is looked up one after the other*/
+    if(kern_index_last && kern_index_last->fdsc == fdsc) return kern_index_last;
+
+    lv_font_fmt_txt_kern_index_t * index;
+    LV_LL_READ(kern_index_ll_p, index) {
+        if(index->fdsc == fdsc) {
+            kern_index_last = index;
+            return index;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Put the kerning pairs into a hash table filled at most to 2/3.
+ * @param index     allocate the table here
+ * @param kdsc      the kerning pairs
+ * @return          false: out of memory
+ */
+static bool build_kern_index(lv_font_fmt_txt_kern_index_t * index, const lv_font_fmt_txt_kern_pair_t * kdsc)
+{
+    uint32_t slot_cnt = 8;
+    uint8_t shift = 32 - 3;
+    while(slot_cnt * 2 < kdsc->pair_cnt * 3) {
+        slot_cnt <<= 1;
+        shift--;
+    }
+
+    index->keys = lv_malloc_zeroed(slot_cnt * sizeof(uint32_t));
+    index->values = lv_malloc(slot_cnt * sizeof(int8_t));
+    if(index->keys == NULL || index->values == NULL) return false;
+    index->mask = slot_cnt - 1;
+    index->shift = shift;
+    index->size = slot_cnt * (sizeof(uint32_t) + sizeof(int8_t));
+
+    uint32_t i;
+    for(i = 0; i < kdsc->pair_cnt; i++) {
+        uint32_t key;
+        if(kdsc->glyph_ids_size == 0) {
+            const uint8_t * g_ids = kdsc->glyph_ids;
+            key = ((uint32_t)g_ids[i * 2] << 16) | g_ids[i * 2 + 1];
+        }
+        else {
+            const uint16_t * g_ids = kdsc->glyph_ids;
+            key = ((uint32_t)g_ids[i * 2] << 16) | g_ids[i * 2 + 1];
+        }
+
+        /*The glyph ID 0 is not used, so the key of a pair is never 0*/
+        uint32_t slot = kern_index_get_slot(index, key);
+        if(index->keys[slot] == key) continue;
+        index->keys[slot] = key;
+        index->values[slot] = kdsc->values[i];
+    }
+
+    return true;
+}
+
+/**
+ * Find the slot of a pair or the empty slot where it should be.
+ * @param index     the hash table
+ * @param key       `(left_gid << 16) | right_gid`
+ * @return          index of the slot
+ */
+static inline uint32_t kern_index_get_slot(const lv_font_fmt_txt_kern_index_t * index, uint32_t key)
+{
+    uint32_t slot = (key * 2654435761u) >> index->shift;
+    while(index->keys[slot] != key && index->keys[slot] != 0) {
+        slot = (slot + 1) & index->mask;
+    }
+
+    return slot;
+}
+
+#endif /*LV_FONT_FMT_TXT_KERN_INDEX*/
+
 #if LV_USE_FONT_COMPRESSED
 
 /**
@@ -224,6 +224,80 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+#if LV_FONT_GLYPH_CACHE_SIZE
+
+/**
+ * Get the counters of the cache of the expanded glyphs.
+ * @param stats     store the counters here
+ */
+void lv_font_fmt_txt_glyph_cache_get_stats(lv_font_glyph_cache_stats_t * stats);
+
+/**
+ * Clear the counters of the cache of the expanded glyphs.
+ */
+void lv_font_fmt_txt_glyph_cache_reset_stats(void);
+
+/**
+ * Remove all the glyphs from the cache. Needs to be called if the bitmaps of a font
+ * are changed or a font is freed.
+ */
+void lv_font_fmt_txt_glyph_cache_drop_all(void);
+
+#endif /*LV_FONT_GLYPH_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+
+/**
+ * Build lookup tables for the sparse cmaps of a font so that its glyphs are found
+ * without a binary search. Should be called once, when the font is registered.
+ * @param font      a font using `lv_font_get_glyph_dsc_fmt_txt`
+ * @return          LV_RESULT_OK: the tables are built (or were already built);
+ *                  LV_RESULT_INVALID: not a font of this format or out of memory
+ */
+lv_result_t lv_font_fmt_txt_cmap_index_create(const lv_font_t * font);
+
+/**
+ * Delete the lookup tables of a font. Needs to be called before the font's descriptor is freed.
+ * @param font      pointer to a font
+ */
+void lv_font_fmt_txt_cmap_index_delete(const lv_font_t * font);
+
+/**
+ * Get the memory used by the lookup tables of a font.
+ * @param font      pointer to a font
+ * @return          size of the tables in bytes or 0 if they are not built
+ */
+uint32_t lv_font_fmt_txt_cmap_index_get_size(const lv_font_t * font);
+
+#endif /*LV_FONT_FMT_TXT_CMAP_INDEX*/
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+
+/**
+ * Build a hash table of the kerning pairs of a font so that the kerning of two glyphs
+ * is found without a binary search. Nothing is built for fonts with kerning classes
+ * as their kerning is already found by indexing.
+ * @param font      a font using `lv_font_get_glyph_dsc_fmt_txt`
+ * @return          LV_RESULT_OK: the table is built (or not needed);
+ *                  LV_RESULT_INVALID: not a font of this format or out of memory
+ */
+lv_result_t lv_font_fmt_txt_kern_index_create(const lv_font_t * font);
+
+/**
+ * Delete the kerning hash table of a font. Needs to be called before the font's descriptor is freed.
+ * @param font      pointer to a font
+ */
+void lv_font_fmt_txt_kern_index_delete(const lv_font_t * font);
+
+/**
+ * Get the memory used by the kerning hash table of a font.
+ * @param font      pointer to a font
+ * @return          size of the table in bytes or 0 if it's not built
+ */
+uint32_t lv_font_fmt_txt_kern_index_get_size(const lv_font_t * font);
+
+#endif /*LV_FONT_FMT_TXT_KERN_INDEX*/
+
 /**********************
  *      MACROS
  **********************/
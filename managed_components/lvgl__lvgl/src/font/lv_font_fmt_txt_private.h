@@ -41,10 +41,108 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+/** Counters of the cache of the expanded glyphs*/
+struct _lv_font_glyph_cache_stats_t {
+    uint32_t hit_cnt;       /**< Number of glyphs drawn from the cache*/
+    uint32_t miss_cnt;      /**< Number of glyphs which were expanded*/
+};
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+
+/** Marks the empty pages in `lv_font_fmt_txt_cmap_lut_t::page_ids`*/
+#define LV_FONT_FMT_TXT_CMAP_PAGE_NONE  0xFFFF
+
+/** The code points of a sparse cmap in a 256 code point long page*/
+typedef struct {
+    uint32_t bits[8];           /**< A bit for every code point which is in `unicode_list`*/
+    uint16_t base;              /**< Index in `unicode_list` of the first code point of the page*/
+    uint8_t word_base[8];       /**< Number of code points of the page before `bits[i]`*/
+} lv_font_fmt_txt_cmap_page_t;
+
+/** Two-level lookup table of a sparse cmap. The index of a code point in `unicode_list` is
+ * `base` + `word_base` + the number of bits set below it in its word of the page.*/
+typedef struct {
+    uint16_t * page_ids;                    /**< Index in `pages` of every 256 relative code points or
+                                             *  `LV_FONT_FMT_TXT_CMAP_PAGE_NONE`. NULL if the cmap is not sparse.*/
+    lv_font_fmt_txt_cmap_page_t * pages;    /**< Only the pages with code points*/
+} lv_font_fmt_txt_cmap_lut_t;
+
+/** The lookup tables of the cmaps of a font*/
+struct _lv_font_fmt_txt_cmap_index_t {
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    lv_font_fmt_txt_cmap_lut_t * luts;      /**< One for every cmap*/
+    uint32_t size;                          /**< Allocated bytes*/
+};
+
+#endif /*LV_FONT_FMT_TXT_CMAP_INDEX*/
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+
+/** Open addressing hash table of the kerning pairs of a font*/
+struct _lv_font_fmt_txt_kern_index_t {
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    uint32_t * keys;        /**< `(left_gid << 16) | right_gid` or 0 if the slot is empty*/
+    int8_t * values;        /**< The kerning value of the pair in `keys`*/
+    uint32_t mask;          /**< Number of slots - 1*/
+    uint8_t shift;          /**< 32 - log2(number of slots)*/
+    uint32_t size;          /**< Allocated bytes*/
+};
+
+#endif /*LV_FONT_FMT_TXT_KERN_INDEX*/
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_FONT_GLYPH_CACHE_SIZE
+
+/**
+ * Create the cache of the expanded glyphs with `LV_FONT_GLYPH_CACHE_SIZE` bytes.
+ */
+void lv_font_fmt_txt_glyph_cache_init(void);
+
+/**
+ * Delete the cache of the expanded glyphs.
+ */
+void lv_font_fmt_txt_glyph_cache_deinit(void);
+
+/**
+ * Release the cached glyph returned by `lv_font_get_bitmap_fmt_txt`.
+ * @param font      the font of the glyph
+ * @param g_dsc     the glyph descriptor whose `entry` was set by `lv_font_get_bitmap_fmt_txt`
+ */
+void lv_font_fmt_txt_release_glyph(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
+
+#endif /*LV_FONT_GLYPH_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+
+/**
+ * Initialize the list of the cmap lookup tables.
+ */
+void lv_font_fmt_txt_cmap_index_init(void);
+
+/**
+ * Delete the cmap lookup tables of all the fonts.
+ */
+void lv_font_fmt_txt_cmap_index_deinit(void);
+
+#endif /*LV_FONT_FMT_TXT_CMAP_INDEX*/
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+
+/**
+ * Initialize the list of the kerning hash tables.
+ */
+void lv_font_fmt_txt_kern_index_init(void);
+
+/**
+ * Delete the kerning hash tables of all the fonts.
+ */
+void lv_font_fmt_txt_kern_index_deinit(void);
+
+#endif /*LV_FONT_FMT_TXT_KERN_INDEX*/
+
 /**********************
  *      MACROS
  **********************/
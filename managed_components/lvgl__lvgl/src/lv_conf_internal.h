@@ -203,6 +203,30 @@
         #endif
     #endif
 
+    /** Serve allocations up to this size from size classes of 8, 16, 24, ... bytes (0: disable).
+     *  The blocks are cut from 512 byte pages of a separate pool so allocating and freeing them is O(1),
+     *  they have no header and the many small objects (widgets, timers, animations, event and style lists)
+     *  don't fragment the heap. Must be a multiple of 8. */
+    #ifndef LV_MEM_SLAB_SIZE_MAX
+        #ifdef CONFIG_LV_MEM_SLAB_SIZE_MAX
+            #define LV_MEM_SLAB_SIZE_MAX CONFIG_LV_MEM_SLAB_SIZE_MAX
+        #else
+            #define LV_MEM_SLAB_SIZE_MAX 0
+        #endif
+    #endif
+
+    #if LV_MEM_SLAB_SIZE_MAX
+        /** Size of the pool of the slab pages in bytes. It's taken from `LV_MEM_SIZE`.
+         *  Small allocations are served by the heap if the pool is full. */
+        #ifndef LV_MEM_SLAB_POOL_SIZE
+            #ifdef CONFIG_LV_MEM_SLAB_POOL_SIZE
+                #define LV_MEM_SLAB_POOL_SIZE CONFIG_LV_MEM_SLAB_POOL_SIZE
+            #else
+                #define LV_MEM_SLAB_POOL_SIZE (8 * 1024U)
+            #endif
+        #endif
+    #endif
+
     /** Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too. */
     #ifndef LV_MEM_ADR
         #ifdef CONFIG_LV_MEM_ADR
@@ -366,6 +390,37 @@
     #endif
 #endif
 
+/** Allocate draw tasks (and their draw descriptors) from a bump arena made of chunks of this size
+ * instead of calling `lv_malloc` for each of them. The arena is rewound when the last draw task is
+ * freed (at the latest when a refreshed area is finished), so its chunks are reused in every frame.
+ * Draw tasks larger than a chunk still use `lv_malloc`. Set it to 0 to disable the arena. */
+#ifndef LV_DRAW_TASK_ARENA_CHUNK_SIZE
+    #ifdef CONFIG_LV_DRAW_TASK_ARENA_CHUNK_SIZE
+        #define LV_DRAW_TASK_ARENA_CHUNK_SIZE CONFIG_LV_DRAW_TASK_ARENA_CHUNK_SIZE
+    #else
+        #define LV_DRAW_TASK_ARENA_CHUNK_SIZE   (2 * 1024)   /**< [bytes]*/
+    #endif
+#endif
+
+/** With more than one draw unit the dispatcher checks if a draw task overlaps any older ones.
+ * If a layer has at least `LV_DRAW_TASK_GRID_MIN_TASKS` draw tasks, a grid of
+ * `LV_DRAW_TASK_GRID_LEVELS` levels (1x1, 2x2, 4x4, ... cells) is built to find the overlapping ones
+ * without checking all older draw tasks. Set `LV_DRAW_TASK_GRID_LEVELS` to 0 to disable the grid. */
+#ifndef LV_DRAW_TASK_GRID_LEVELS
+    #ifdef CONFIG_LV_DRAW_TASK_GRID_LEVELS
+        #define LV_DRAW_TASK_GRID_LEVELS CONFIG_LV_DRAW_TASK_GRID_LEVELS
+    #else
+        #define LV_DRAW_TASK_GRID_LEVELS        4
+    #endif
+#endif
+#ifndef LV_DRAW_TASK_GRID_MIN_TASKS
+    #ifdef CONFIG_LV_DRAW_TASK_GRID_MIN_TASKS
+        #define LV_DRAW_TASK_GRID_MIN_TASKS CONFIG_LV_DRAW_TASK_GRID_MIN_TASKS
+    #else
+        #define LV_DRAW_TASK_GRID_MIN_TASKS     32
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -1446,6 +1501,18 @@
     #endif
 #endif
 
+/** 1: Store the decoded images only if they are used more often than the images they would evict.
+ *  Large, rarely used images don't flush the small, frequently used ones and an image which is
+ *  not stored is still decoded and drawn. `lv_image_cache_get_stats()` returns the hit and eviction counters.
+ *  0: Use an LRU image cache. */
+#ifndef LV_IMAGE_CACHE_TINYLFU
+    #ifdef CONFIG_LV_IMAGE_CACHE_TINYLFU
+        #define LV_IMAGE_CACHE_TINYLFU CONFIG_LV_IMAGE_CACHE_TINYLFU
+    #else
+        #define LV_IMAGE_CACHE_TINYLFU  0
+    #endif
+#endif
+
 /** Default number of image header cache entries. The cache is used to store the headers of images
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #ifndef LV_IMAGE_HEADER_CACHE_DEF_CNT
@@ -1489,6 +1556,45 @@
     #endif
 #endif
 
+/** Number of resolved style properties cached per `lv_obj_t` (0: disable the cache).
+ *  The final value of a property (including inheritance and the default value) is stored for the
+ *  part and state it was read in, so redrawing an unchanged object doesn't walk its style list again.
+ *  A widget reads about 40..60 properties while drawing, so use e.g. 64 to avoid evicting them.
+ *  The cache of an object is allocated on the first style property lookup and takes
+ *  about `8 * LV_OBJ_STYLE_RESOLVED_CACHE_SIZE` bytes. */
+#ifndef LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+        #define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    #else
+        #define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE    0
+    #endif
+#endif
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    /** Upper limit for the memory of all resolved style caches in bytes.
+     *  Objects read their style properties without a cache once the limit is reached. */
+    #ifndef LV_OBJ_STYLE_RESOLVED_CACHE_MEM_MAX
+        #ifdef CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_MEM_MAX
+            #define LV_OBJ_STYLE_RESOLVED_CACHE_MEM_MAX CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_MEM_MAX
+        #else
+            #define LV_OBJ_STYLE_RESOLVED_CACHE_MEM_MAX  (8 * 1024)
+        #endif
+    #endif
+#endif
+
+/** Speed up running many animations and style transitions.
+ *  - The ease and overshoot paths read their steps from a table instead of solving the bezier curve.
+ *    A 2 kB table is allocated for each of these paths when it's used first.
+ *  - Changing drawing-only style properties (e.g. colors and opacity) invalidates an object only once
+ *    per frame even if several properties are animated. */
+#ifndef LV_ANIM_BATCH
+    #ifdef CONFIG_LV_ANIM_BATCH
+        #define LV_ANIM_BATCH CONFIG_LV_ANIM_BATCH
+    #else
+        #define LV_ANIM_BATCH   0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1956,6 +2062,41 @@
     #endif
 #endif
 
+/** Size of the cache of the glyphs of the built-in font format (in bytes), e.g. 4 * 1024.
+ *  The 1, 2 and 4 bpp and compressed glyphs are expanded to A8 for drawing.
+ *  The expanded glyphs are stored here so redrawing the same characters doesn't decode them again.
+ *  `lv_font_fmt_txt_glyph_cache_get_stats()` returns the hit and miss counters.
+ *  0: Expand the glyphs every time they are drawn. */
+#ifndef LV_FONT_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_GLYPH_CACHE_SIZE
+        #define LV_FONT_GLYPH_CACHE_SIZE CONFIG_LV_FONT_GLYPH_CACHE_SIZE
+    #else
+        #define LV_FONT_GLYPH_CACHE_SIZE 0
+    #endif
+#endif
+
+/** 1: Glyph-id lookup tables can be built with `lv_font_fmt_txt_cmap_index_create()`
+ *  so that the characters of the sparse character maps (e.g. CJK fonts) are found without a binary search.
+ *  The tables of the fonts loaded by `lv_binfont_create()` are built automatically. */
+#ifndef LV_FONT_FMT_TXT_CMAP_INDEX
+    #ifdef CONFIG_LV_FONT_FMT_TXT_CMAP_INDEX
+        #define LV_FONT_FMT_TXT_CMAP_INDEX CONFIG_LV_FONT_FMT_TXT_CMAP_INDEX
+    #else
+        #define LV_FONT_FMT_TXT_CMAP_INDEX 0
+    #endif
+#endif
+
+/** 1: Hash tables of the kerning pairs can be built with `lv_font_fmt_txt_kern_index_create()`
+ *  so that the kerning of the fonts without kerning classes is found without a binary search.
+ *  The tables of the fonts loaded by `lv_binfont_create()` are built automatically. */
+#ifndef LV_FONT_FMT_TXT_KERN_INDEX
+    #ifdef CONFIG_LV_FONT_FMT_TXT_KERN_INDEX
+        #define LV_FONT_FMT_TXT_KERN_INDEX CONFIG_LV_FONT_FMT_TXT_KERN_INDEX
+    #else
+        #define LV_FONT_FMT_TXT_KERN_INDEX 0
+    #endif
+#endif
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef LV_KCONFIG_PRESENT
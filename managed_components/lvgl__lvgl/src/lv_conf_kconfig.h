@@ -123,6 +123,10 @@ extern "C" {
 #  define CONFIG_LV_MEM_POOL_EXPAND_SIZE (CONFIG_LV_MEM_POOL_EXPAND_SIZE_KILOBYTES * 1024U)
 #endif
 
+#ifdef CONFIG_LV_MEM_SLAB_POOL_SIZE_KILOBYTES
+#  define CONFIG_LV_MEM_SLAB_POOL_SIZE (CONFIG_LV_MEM_SLAB_POOL_SIZE_KILOBYTES * 1024U)
+#endif
+
 /*------------------
  * MONITOR POSITION
  *-----------------*/
@@ -296,6 +296,18 @@ void lv_init(void)
     lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
 
+#if LV_FONT_GLYPH_CACHE_SIZE
+    lv_font_fmt_txt_glyph_cache_init();
+#endif
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+    lv_font_fmt_txt_cmap_index_init();
+#endif
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+    lv_font_fmt_txt_kern_index_init();
+#endif
+
 #if LV_USE_DRAW_VG_LITE
     lv_draw_vg_lite_init();
 #endif
@@ -465,6 +477,18 @@ void lv_deinit(void)
 
     lv_image_decoder_deinit();
 
+#if LV_FONT_GLYPH_CACHE_SIZE
+    lv_font_fmt_txt_glyph_cache_deinit();
+#endif
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX
+    lv_font_fmt_txt_cmap_index_deinit();
+#endif
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+    lv_font_fmt_txt_kern_index_deinit();
+#endif
+
     lv_refr_deinit();
 
     lv_obj_style_deinit();
@@ -13,6 +13,8 @@
 
 #include "lv_cache_lru_rb.h"
 #include "lv_cache_lru_ll.h"
+#include "lv_cache_lru_ht.h"
 #include "lv_cache_sc_da.h"
+#include "lv_cache_tinylfu.h"
 
 #endif //LV_CACHE_CLAZZ_H
@@ -0,0 +1,566 @@
+/**
+* @file lv_cache_lru_ht.c
+*
+*/
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_cache_lru_ht.h"
+#include "../lv_cache_entry.h"
+#include "../lv_cache_entry_private.h"
+#include "../../../stdlib/lv_mem.h"
+#include "../../../stdlib/lv_sprintf.h"
+#include "../../../stdlib/lv_string.h"
+#include "../../lv_assert.h"
+#include "../../lv_log.h"
+#include "../../lv_iter.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Initial number of slots of the hash table. Power of 2.*/
+#define SLOT_CNT_MIN        16
+
+/*Grow the table when this part of the slots is used (in percentage)*/
+#define LOAD_PCT_MAX        75
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef uint32_t (get_data_size_cb_t)(const void * data);
+
+/*Stored after the entry of each node*/
+typedef struct {
+    void * prev;        /*Data of the previous (more recently used) node*/
+    void * next;
+    uint32_t hash;
+} node_link_t;
+
+typedef struct {
+    uint32_t hash;
+    void * data;        /*NULL if the slot is empty*/
+} slot_t;
+
+typedef struct {
+    lv_cache_t cache;
+
+    slot_t * slots;
+    uint32_t slot_cnt;
+    uint32_t node_cnt;
+
+    void * head;        /*The most recently used node*/
+    void * tail;
+
+    get_data_size_cb_t * get_data_size_cb;
+} lv_lru_ht_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void * alloc_cb(void);
+static bool init_cnt_cb(lv_cache_t * cache);
+static bool init_size_cb(lv_cache_t * cache);
+static void destroy_cb(lv_cache_t * cache, void * user_data);
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void drop_all_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data);
+
+static uint32_t cnt_get_data_size_cb(const void * data);
+static uint32_t size_get_data_size_cb(const void * data);
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache);
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem);
+
+static bool init_common(lv_lru_ht_t * lru);
+static inline node_link_t * get_link(lv_lru_ht_t * lru, void * data);
+static uint32_t find_slot(lv_lru_ht_t * lru, const void * key, uint32_t hash);
+static bool grow_slots(lv_lru_ht_t * lru);
+static void remove_slot(lv_lru_ht_t * lru, uint32_t idx);
+static void list_push_head(lv_lru_ht_t * lru, void * data);
+static void list_unlink(lv_lru_ht_t * lru, void * data);
+static void unlink_node(lv_lru_ht_t * lru, void * data);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const lv_cache_class_t lv_cache_class_lru_ht_count = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_cnt_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+
+const lv_cache_class_t lv_cache_class_lru_ht_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_size_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void * alloc_cb(void)
+{
+    void * res = lv_malloc_zeroed(sizeof(lv_lru_ht_t));
+    LV_ASSERT_MALLOC(res);
+    if(res == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    return res;
+}
+
+static bool init_cnt_cb(lv_cache_t * cache)
+{
+    lv_lru_ht_t * lru = (lv_lru_ht_t *)cache;
+    lru->get_data_size_cb = cnt_get_data_size_cb;
+    return init_common(lru);
+}
+
+static bool init_size_cb(lv_cache_t * cache)
+{
+    lv_lru_ht_t * lru = (lv_lru_ht_t *)cache;
+    lru->get_data_size_cb = size_get_data_size_cb;
+    return init_common(lru);
+}
+
+static void destroy_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_lru_ht_t * lru = (lv_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    if(lru == NULL) {
+        return;
+    }
+
+    cache->clz->drop_all_cb(cache, user_data);
+
+    lv_free(lru->slots);
+    lru->slots = NULL;
+    lru->slot_cnt = 0;
+}
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_ht_t * lru = (lv_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return NULL;
+    }
+
+    uint32_t idx = find_slot(lru, key, cache->ops.hash_cb(key));
+    if(idx == UINT32_MAX) {
+        return NULL;
+    }
+
+    /*cache hit*/
+    void * data = lru->slots[idx].data;
+    if(lru->head != data) {
+        list_unlink(lru, data);
+        list_push_head(lru, data);
+    }
+
+    return lv_cache_entry_get_entry(data, cache->node_size);
+}
+
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_ht_t * lru = (lv_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return NULL;
+    }
+
+    /*Keep at least one empty slot to terminate the probing*/
+    if((uint64_t)(lru->node_cnt + 1) * 100 > (uint64_t)lru->slot_cnt * LOAD_PCT_MAX) {
+        if(!grow_slots(lru) && lru->node_cnt + 1 >= lru->slot_cnt) {
+            return NULL;
+        }
+    }
+
+    uint32_t node_size = cache->node_size;
+    void * data = lv_malloc_zeroed(lv_cache_entry_get_size(node_size) + sizeof(node_link_t));
+    LV_ASSERT_MALLOC(data);
+    if(data == NULL) {
+        return NULL;
+    }
+
+    lv_memcpy(data, key, node_size);
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, node_size);
+    lv_cache_entry_init(entry, cache, node_size);
+
+    uint32_t hash = cache->ops.hash_cb(key);
+    get_link(lru, data)->hash = hash;
+
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t idx = hash & mask;
+    while(lru->slots[idx].data) idx = (idx + 1) & mask;
+    lru->slots[idx].hash = hash;
+    lru->slots[idx].data = data;
+    lru->node_cnt++;
+
+    list_push_head(lru, data);
+    cache->size += lru->get_data_size_cb(key);
+
+    return entry;
+}
+
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_ht_t * lru = (lv_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(entry);
+
+    if(lru == NULL || entry == NULL) {
+        return;
+    }
+
+    unlink_node(lru, lv_cache_entry_get_data(entry));
+}
+
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_lru_ht_t * lru = (lv_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return;
+    }
+
+    uint32_t idx = find_slot(lru, key, cache->ops.hash_cb(key));
+    if(idx == UINT32_MAX) {
+        return;
+    }
+
+    void * data = lru->slots[idx].data;
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+    unlink_node(lru, data);
+
+    if(lv_cache_entry_get_ref(entry) == 0) {
+        cache->ops.free_cb(data, user_data);
+        lv_cache_entry_delete(entry);
+    }
+    else {
+        /*Free it when it's released*/
+        lv_cache_entry_set_flag(entry, LV_CACHE_ENTRY_FLAG_INVALID);
+    }
+}
+
+static void drop_all_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_lru_ht_t * lru = (lv_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    if(lru == NULL) {
+        return;
+    }
+
+    uint32_t used_cnt = 0;
+    void * data = lru->head;
+    while(data) {
+        void * next = get_link(lru, data)->next;
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+        /*free user handled data and do other clean up*/
+        if(lv_cache_entry_get_ref(entry) == 0) {
+            cache->ops.free_cb(data, user_data);
+        }
+        else {
+            LV_LOG_WARN("entry (%p) is still referenced (%" LV_PRId32 ")", (void *)entry, lv_cache_entry_get_ref(entry));
+            used_cnt++;
+        }
+        lv_cache_entry_delete(entry);
+        data = next;
+    }
+    if(used_cnt > 0) {
+        LV_LOG_WARN("%" LV_PRId32 " entries are still referenced", used_cnt);
+    }
+
+    if(lru->slots) lv_memzero(lru->slots, lru->slot_cnt * sizeof(slot_t));
+    lru->node_cnt = 0;
+    lru->head = NULL;
+    lru->tail = NULL;
+
+    cache->size = 0;
+}
+
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_ht_t * lru = (lv_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    void * data;
+    for(data = lru->tail; data; data = get_link(lru, data)->prev) {
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) == 0) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_ht_t * lru = (lv_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    if(lru == NULL) {
+        return LV_CACHE_RESERVE_COND_ERROR;
+    }
+
+    uint32_t data_size = key ? lru->get_data_size_cb(key) : 0;
+    if(data_size > lru->cache.max_size) {
+        LV_LOG_ERROR("data size (%" LV_PRIu32 ") is larger than max size (%" LV_PRIu32 ")", data_size, lru->cache.max_size);
+        return LV_CACHE_RESERVE_COND_TOO_LARGE;
+    }
+
+    return cache->size + reserved_size + data_size > lru->cache.max_size
+           ? LV_CACHE_RESERVE_COND_NEED_VICTIM
+           : LV_CACHE_RESERVE_COND_OK;
+}
+
+static uint32_t cnt_get_data_size_cb(const void * data)
+{
+    LV_UNUSED(data);
+    return 1;
+}
+
+static uint32_t size_get_data_size_cb(const void * data)
+{
+    lv_cache_slot_size_t * slot = (lv_cache_slot_size_t *)data;
+    return slot->size;
+}
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache)
+{
+    return lv_iter_create(cache, lv_cache_entry_get_size(cache->node_size), sizeof(void *), cache_iter_next_cb);
+}
+
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem)
+{
+    lv_lru_ht_t * lru = (lv_lru_ht_t *)instance;
+    void ** data = context;
+
+    LV_ASSERT_NULL(data);
+
+    if(*data == NULL) *data = lru->head;
+    else *data = get_link(lru, *data)->next;
+
+    if(*data == NULL) return LV_RESULT_INVALID;
+
+    lv_memcpy(elem, *data, lv_cache_entry_get_size(lru->cache.node_size));
+
+    return LV_RESULT_OK;
+}
+
+static bool init_common(lv_lru_ht_t * lru)
+{
+    LV_ASSERT_NULL(lru->cache.ops.compare_cb);
+    LV_ASSERT_NULL(lru->cache.ops.free_cb);
+    LV_ASSERT_NULL(lru->cache.ops.hash_cb);
+    LV_ASSERT(lru->cache.node_size > 0);
+
+    if(lru->cache.node_size <= 0 || lru->cache.ops.compare_cb == NULL || lru->cache.ops.free_cb == NULL ||
+       lru->cache.ops.hash_cb == NULL) {
+        return false;
+    }
+
+    lru->slots = lv_malloc_zeroed(SLOT_CNT_MIN * sizeof(slot_t));
+    LV_ASSERT_MALLOC(lru->slots);
+    if(lru->slots == NULL) {
+        return false;
+    }
+
+    lru->slot_cnt = SLOT_CNT_MIN;
+    return true;
+}
+
+static inline node_link_t * get_link(lv_lru_ht_t * lru, void * data)
+{
+    return (node_link_t *)((uint8_t *)data + lv_cache_entry_get_size(lru->cache.node_size));
+}
+
+/**
+ * Find the slot of a key with linear probing. Only the keys with the same hash are compared.
+ * @param lru       pointer to the cache
+ * @param key       the key to find
+ * @param hash      the hash of the key
+ * @return          index of the slot or UINT32_MAX if the key is not in the cache
+ */
+static uint32_t find_slot(lv_lru_ht_t * lru, const void * key, uint32_t hash)
+{
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t idx = hash & mask;
+    while(lru->slots[idx].data) {
+        if(lru->slots[idx].hash == hash && lru->cache.ops.compare_cb(lru->slots[idx].data, key) == 0) {
+            return idx;
+        }
+        idx = (idx + 1) & mask;
+    }
+
+    return UINT32_MAX;
+}
+
+static bool grow_slots(lv_lru_ht_t * lru)
+{
+    uint32_t slot_cnt = lru->slot_cnt * 2;
+    slot_t * slots = lv_malloc_zeroed(slot_cnt * sizeof(slot_t));
+    LV_ASSERT_MALLOC(slots);
+    if(slots == NULL) {
+        LV_LOG_WARN("couldn't grow the hash table to %" LV_PRIu32 " slots", slot_cnt);
+        return false;
+    }
+
+    /*Rehash with the stored hashes, the keys are not hashed again*/
+    uint32_t mask = slot_cnt - 1;
+    uint32_t i;
+    for(i = 0; i < lru->slot_cnt; i++) {
+        if(lru->slots[i].data == NULL) continue;
+        uint32_t idx = lru->slots[i].hash & mask;
+        while(slots[idx].data) idx = (idx + 1) & mask;
+        slots[idx] = lru->slots[i];
+    }
+
+    lv_free(lru->slots);
+    lru->slots = slots;
+    lru->slot_cnt = slot_cnt;
+    return true;
+}
+
+/**
+ * Empty a slot and move the following slots of the probe sequence back,
+ * so no tombstones are needed.
+ * @param lru       pointer to the cache
+ * @param idx       index of the slot to empty
+ */
+static void remove_slot(lv_lru_ht_t * lru, uint32_t idx)
+{
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t next = idx;
+    while(1) {
+        next = (next + 1) & mask;
+        if(lru->slots[next].data == NULL) break;
+
+        /*Keep it if its home slot is cyclically in (idx, next]*/
+        uint32_t home = lru->slots[next].hash & mask;
+        bool keep = idx <= next ? (idx < home && home <= next) : (idx < home || home <= next);
+        if(keep) continue;
+
+        lru->slots[idx] = lru->slots[next];
+        idx = next;
+    }
+
+    lru->slots[idx].data = NULL;
+    lru->node_cnt--;
+}
+
+static void list_push_head(lv_lru_ht_t * lru, void * data)
+{
+    node_link_t * link = get_link(lru, data);
+
+    link->prev = NULL;
+    link->next = lru->head;
+    if(lru->head) get_link(lru, lru->head)->prev = data;
+    else lru->tail = data;
+    lru->head = data;
+}
+
+static void list_unlink(lv_lru_ht_t * lru, void * data)
+{
+    node_link_t * link = get_link(lru, data);
+
+    if(link->prev) get_link(lru, link->prev)->next = link->next;
+    else lru->head = link->next;
+    if(link->next) get_link(lru, link->next)->prev = link->prev;
+    else lru->tail = link->prev;
+
+    link->prev = NULL;
+    link->next = NULL;
+}
+
+/**
+ * Remove a node from the hash table and the LRU list, but don't free it.
+ * @param lru       pointer to the cache
+ * @param data      data of the node
+ */
+static void unlink_node(lv_lru_ht_t * lru, void * data)
+{
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t idx = get_link(lru, data)->hash & mask;
+    while(lru->slots[idx].data) {
+        if(lru->slots[idx].data == data) {
+            remove_slot(lru, idx);
+            list_unlink(lru, data);
+            lru->cache.size -= lru->get_data_size_cb(data);
+            return;
+        }
+        idx = (idx + 1) & mask;
+    }
+}
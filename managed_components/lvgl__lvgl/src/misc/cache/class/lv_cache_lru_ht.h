@@ -0,0 +1,51 @@
+/**
+* @file lv_cache_lru_ht.h
+*
+*/
+
+#ifndef LV_CACHE_LRU_HT_H
+#define LV_CACHE_LRU_HT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_cache_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**
+ * LRU caches indexed by an open addressing hash table instead of a red-black tree.
+ * A lookup compares only the entries with the same hash, so it's O(1) even with
+ * string keys. The hash of each entry is computed once, when it's added.
+ * Requires `lv_cache_ops_t::hash_cb`.
+ */
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_cache_class_t lv_cache_class_lru_ht_count;
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_cache_class_t lv_cache_class_lru_ht_size;
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_CACHE_LRU_HT_H*/
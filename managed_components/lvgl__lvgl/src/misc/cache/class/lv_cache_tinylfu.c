@@ -0,0 +1,578 @@
+/**
+* @file lv_cache_tinylfu.c
+*
+*/
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_cache_tinylfu.h"
+#include "../lv_cache_entry.h"
+#include "../lv_cache_entry_private.h"
+#include "../../../stdlib/lv_sprintf.h"
+#include "../../../stdlib/lv_string.h"
+#include "../../lv_rb_private.h"
+#include "../../lv_rb.h"
+#include "../../lv_iter.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Counters per row of the frequency sketch. Power of 2.*/
+#define SKETCH_WIDTH        64
+#define SKETCH_WIDTH_SHIFT  6
+#define SKETCH_DEPTH        4
+#define SKETCH_COUNTER_MAX  15
+
+/*Halve the counters after this many accesses to forget the old ones*/
+#define SKETCH_SAMPLE_CNT   (10 * SKETCH_WIDTH)
+
+/*The protected segment can use this part of the cache (in percentage)*/
+#define PROTECTED_PCT       80
+
+/*The entry is not in the cache, it's freed when released*/
+#define ENTRY_FLAG_DETACHED LV_CACHE_ENTRY_FLAG_CLASS_CUSTOM
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    SEGMENT_PROBATION,
+    SEGMENT_PROTECTED,
+} segment_t;
+
+/*Stored after the entry of each node*/
+typedef struct {
+    void * prev;        /*Data of the previous (more recently used) node in the segment*/
+    void * next;
+    uint32_t hash;
+    uint8_t segment;
+} node_link_t;
+
+typedef struct {
+    void * head;
+    void * tail;
+    uint32_t size;
+} segment_list_t;
+
+typedef struct {
+    lv_cache_t cache;
+
+    lv_rb_t rb;
+    segment_list_t segments[2];
+
+    uint8_t sketch[SKETCH_DEPTH][SKETCH_WIDTH];
+    uint32_t sketch_add_cnt;
+
+    /*Set by `reserve_cond_cb` for the following `add_cb`*/
+    bool reject_next;
+
+    /*The hash of the last missed lookup to not count the access again in `add_cb`*/
+    bool miss_pending;
+    uint32_t miss_hash;
+
+    lv_cache_tinylfu_stats_t stats;
+} lv_cache_tinylfu_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void * alloc_cb(void);
+static bool init_cb(lv_cache_t * cache);
+static void destroy_cb(lv_cache_t * cache, void * user_data);
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void drop_all_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data);
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache);
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem);
+
+static inline node_link_t * get_link(lv_cache_tinylfu_t * lfu, void * data);
+static inline uint32_t get_data_size(const void * data);
+static void segment_push_head(lv_cache_tinylfu_t * lfu, void * data, segment_t segment);
+static void segment_unlink(lv_cache_tinylfu_t * lfu, void * data);
+static void * get_next_victim(lv_cache_tinylfu_t * lfu, void * data);
+static void sketch_increment(lv_cache_tinylfu_t * lfu, uint32_t hash);
+static uint32_t sketch_estimate(lv_cache_tinylfu_t * lfu, uint32_t hash);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const lv_cache_class_t lv_cache_class_tinylfu_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const uint32_t sketch_seeds[SKETCH_DEPTH] = {0x9E3779B1, 0x85EBCA77, 0xC2B2AE3D, 0x27D4EB2F};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_cache_tinylfu_get_stats(lv_cache_t * cache, lv_cache_tinylfu_stats_t * stats)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(stats);
+    LV_ASSERT(cache->clz == &lv_cache_class_tinylfu_size);
+
+    lv_mutex_lock(&cache->lock);
+    *stats = ((lv_cache_tinylfu_t *)cache)->stats;
+    lv_mutex_unlock(&cache->lock);
+}
+
+void lv_cache_tinylfu_reset_stats(lv_cache_t * cache)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT(cache->clz == &lv_cache_class_tinylfu_size);
+
+    lv_mutex_lock(&cache->lock);
+    lv_memzero(&((lv_cache_tinylfu_t *)cache)->stats, sizeof(lv_cache_tinylfu_stats_t));
+    lv_mutex_unlock(&cache->lock);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void * alloc_cb(void)
+{
+    void * res = lv_malloc_zeroed(sizeof(lv_cache_tinylfu_t));
+    LV_ASSERT_MALLOC(res);
+    if(res == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    return res;
+}
+
+static bool init_cb(lv_cache_t * cache)
+{
+    lv_cache_tinylfu_t * lfu = (lv_cache_tinylfu_t *)cache;
+
+    LV_ASSERT_NULL(lfu->cache.ops.compare_cb);
+    LV_ASSERT_NULL(lfu->cache.ops.free_cb);
+    LV_ASSERT_NULL(lfu->cache.ops.hash_cb);
+    LV_ASSERT(lfu->cache.node_size > 0);
+
+    if(lfu->cache.node_size <= 0 || lfu->cache.ops.compare_cb == NULL || lfu->cache.ops.free_cb == NULL ||
+       lfu->cache.ops.hash_cb == NULL) {
+        return false;
+    }
+
+    /*add the link of the segment list*/
+    return lv_rb_init(&lfu->rb, lfu->cache.ops.compare_cb,
+                      lv_cache_entry_get_size(lfu->cache.node_size) + sizeof(node_link_t));
+}
+
+static void destroy_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_ASSERT_NULL(cache);
+
+    if(cache == NULL) {
+        return;
+    }
+
+    cache->clz->drop_all_cb(cache, user_data);
+}
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_tinylfu_t * lfu = (lv_cache_tinylfu_t *)cache;
+
+    LV_ASSERT_NULL(lfu);
+    LV_ASSERT_NULL(key);
+
+    if(lfu == NULL || key == NULL) {
+        return NULL;
+    }
+
+    uint32_t hash = cache->ops.hash_cb(key);
+    sketch_increment(lfu, hash);
+
+    lv_rb_node_t * node = lv_rb_find(&lfu->rb, key);
+    if(node == NULL) {
+        lfu->stats.miss_cnt++;
+        lfu->miss_pending = true;
+        lfu->miss_hash = hash;
+        return NULL;
+    }
+
+    lfu->stats.hit_cnt++;
+
+    /*Used again: promote it to the protected segment*/
+    void * data = node->data;
+    segment_unlink(lfu, data);
+    segment_push_head(lfu, data, SEGMENT_PROTECTED);
+
+    /*Move the least recently used protected entries back to probation*/
+    uint32_t protected_max = (uint32_t)((uint64_t)cache->max_size * PROTECTED_PCT / 100);
+    segment_list_t * protected = &lfu->segments[SEGMENT_PROTECTED];
+    while(protected->size > protected_max && protected->tail != data) {
+        void * tail = protected->tail;
+        segment_unlink(lfu, tail);
+        segment_push_head(lfu, tail, SEGMENT_PROBATION);
+    }
+
+    return lv_cache_entry_get_entry(data, cache->node_size);
+}
+
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_tinylfu_t * lfu = (lv_cache_tinylfu_t *)cache;
+
+    LV_ASSERT_NULL(lfu);
+    LV_ASSERT_NULL(key);
+
+    if(lfu == NULL || key == NULL) {
+        return NULL;
+    }
+
+    /*Count the access if the lookup before it wasn't counted (e.g. the cache was empty)*/
+    uint32_t hash = cache->ops.hash_cb(key);
+    if(!lfu->miss_pending || lfu->miss_hash != hash) {
+        sketch_increment(lfu, hash);
+        lfu->stats.miss_cnt++;
+    }
+    lfu->miss_pending = false;
+
+    uint32_t node_size = cache->node_size;
+    void * data;
+
+    if(lfu->reject_next) {
+        /*Not admitted. Keep it only until it's released.*/
+        lfu->reject_next = false;
+        data = lv_malloc_zeroed(lv_cache_entry_get_size(node_size) + sizeof(node_link_t));
+        LV_ASSERT_MALLOC(data);
+        if(data == NULL) return NULL;
+
+        lv_memcpy(data, key, node_size);
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, node_size);
+        lv_cache_entry_init(entry, cache, node_size);
+        lv_cache_entry_set_flag(entry, LV_CACHE_ENTRY_FLAG_INVALID | ENTRY_FLAG_DETACHED);
+        lfu->stats.reject_cnt++;
+        return entry;
+    }
+
+    lv_rb_node_t * node = lv_rb_insert(&lfu->rb, (void *)key);
+    if(node == NULL) return NULL;
+
+    data = node->data;
+    lv_memcpy(data, key, node_size);
+    lv_cache_entry_init(lv_cache_entry_get_entry(data, node_size), cache, node_size);
+
+    get_link(lfu, data)->hash = hash;
+    segment_push_head(lfu, data, SEGMENT_PROBATION);
+    cache->size += get_data_size(data);
+    lfu->stats.admit_cnt++;
+
+    return lv_cache_entry_get_entry(data, node_size);
+}
+
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_tinylfu_t * lfu = (lv_cache_tinylfu_t *)cache;
+
+    LV_ASSERT_NULL(lfu);
+    LV_ASSERT_NULL(entry);
+
+    if(lfu == NULL || entry == NULL) {
+        return;
+    }
+
+    if(lv_cache_entry_has_flag(entry, ENTRY_FLAG_DETACHED)) return;
+
+    void * data = lv_cache_entry_get_data(entry);
+    lv_rb_node_t * node = lv_rb_find(&lfu->rb, data);
+    if(node == NULL) {
+        return;
+    }
+
+    segment_unlink(lfu, data);
+    lv_rb_remove_node(&lfu->rb, node);
+    cache->size -= get_data_size(data);
+}
+
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_cache_tinylfu_t * lfu = (lv_cache_tinylfu_t *)cache;
+
+    LV_ASSERT_NULL(lfu);
+    LV_ASSERT_NULL(key);
+
+    if(lfu == NULL || key == NULL) {
+        return;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&lfu->rb, key);
+    if(node == NULL) {
+        return;
+    }
+
+    void * data = node->data;
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+
+    segment_unlink(lfu, data);
+    lv_rb_remove_node(&lfu->rb, node);
+    cache->size -= get_data_size(data);
+
+    if(lv_cache_entry_get_ref(entry) == 0) {
+        cache->ops.free_cb(data, user_data);
+        lv_cache_entry_delete(entry);
+    }
+    else {
+        /*Free it when it's released*/
+        lv_cache_entry_set_flag(entry, LV_CACHE_ENTRY_FLAG_INVALID | ENTRY_FLAG_DETACHED);
+    }
+}
+
+static void drop_all_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_cache_tinylfu_t * lfu = (lv_cache_tinylfu_t *)cache;
+
+    LV_ASSERT_NULL(lfu);
+
+    if(lfu == NULL) {
+        return;
+    }
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        void * data = lfu->segments[i].head;
+        while(data) {
+            void * next = get_link(lfu, data)->next;
+            drop_cb(cache, data, user_data);
+            data = next;
+        }
+    }
+
+    lv_rb_destroy(&lfu->rb);
+    cache->size = 0;
+}
+
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_tinylfu_t * lfu = (lv_cache_tinylfu_t *)cache;
+
+    LV_ASSERT_NULL(lfu);
+
+    void * data = get_next_victim(lfu, NULL);
+    if(data == NULL) return NULL;
+
+    lfu->stats.evict_cnt++;
+    lfu->stats.evict_size += get_data_size(data);
+
+    return lv_cache_entry_get_entry(data, cache->node_size);
+}
+
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_tinylfu_t * lfu = (lv_cache_tinylfu_t *)cache;
+
+    LV_ASSERT_NULL(lfu);
+
+    if(lfu == NULL) {
+        return LV_CACHE_RESERVE_COND_ERROR;
+    }
+
+    uint32_t data_size = key ? get_data_size(key) : 0;
+    if(data_size > cache->max_size) {
+        LV_LOG_ERROR("data size (%" LV_PRIu32 ") is larger than max size (%" LV_PRIu32 ")", data_size, cache->max_size);
+        return LV_CACHE_RESERVE_COND_TOO_LARGE;
+    }
+
+    if(cache->size + reserved_size + data_size <= cache->max_size) return LV_CACHE_RESERVE_COND_OK;
+
+    /*Only reserving space, no new entry*/
+    if(key == NULL) return LV_CACHE_RESERVE_COND_NEED_VICTIM;
+
+    /*Admit the new entry only if it was used more often than all the entries
+     *it would evict together. Large entries need to be used more to be stored.*/
+    uint32_t need_size = cache->size + reserved_size + data_size - cache->max_size;
+    uint32_t victim_size = 0;
+    uint32_t victim_freq = 0;
+    void * victim = get_next_victim(lfu, NULL);
+    while(victim && victim_size < need_size) {
+        victim_size += get_data_size(victim);
+        victim_freq += sketch_estimate(lfu, get_link(lfu, victim)->hash);
+        victim = get_next_victim(lfu, victim);
+    }
+
+    if(victim_size >= need_size &&
+       sketch_estimate(lfu, cache->ops.hash_cb(key)) > victim_freq) {
+        return LV_CACHE_RESERVE_COND_NEED_VICTIM;
+    }
+
+    lfu->reject_next = true;
+    return LV_CACHE_RESERVE_COND_OK;
+}
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache)
+{
+    return lv_iter_create(cache, lv_cache_entry_get_size(cache->node_size), sizeof(void *), cache_iter_next_cb);
+}
+
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem)
+{
+    lv_cache_tinylfu_t * lfu = (lv_cache_tinylfu_t *)instance;
+    void ** data = context;
+
+    LV_ASSERT_NULL(data);
+
+    /*The protected entries first, from the most recently used ones*/
+    if(*data == NULL) {
+        *data = lfu->segments[SEGMENT_PROTECTED].head;
+        if(*data == NULL) *data = lfu->segments[SEGMENT_PROBATION].head;
+    }
+    else {
+        node_link_t * link = get_link(lfu, *data);
+        *data = link->next;
+        if(*data == NULL && link->segment == SEGMENT_PROTECTED) *data = lfu->segments[SEGMENT_PROBATION].head;
+    }
+
+    if(*data == NULL) return LV_RESULT_INVALID;
+
+    lv_memcpy(elem, *data, lv_cache_entry_get_size(lfu->cache.node_size));
+
+    return LV_RESULT_OK;
+}
+
+static inline node_link_t * get_link(lv_cache_tinylfu_t * lfu, void * data)
+{
+    return (node_link_t *)((uint8_t *)data + lv_cache_entry_get_size(lfu->cache.node_size));
+}
+
+static inline uint32_t get_data_size(const void * data)
+{
+    return ((const lv_cache_slot_size_t *)data)->size;
+}
+
+static void segment_push_head(lv_cache_tinylfu_t * lfu, void * data, segment_t segment)
+{
+    segment_list_t * list = &lfu->segments[segment];
+    node_link_t * link = get_link(lfu, data);
+
+    link->segment = segment;
+    link->prev = NULL;
+    link->next = list->head;
+    if(list->head) get_link(lfu, list->head)->prev = data;
+    else list->tail = data;
+    list->head = data;
+    list->size += get_data_size(data);
+}
+
+static void segment_unlink(lv_cache_tinylfu_t * lfu, void * data)
+{
+    node_link_t * link = get_link(lfu, data);
+    segment_list_t * list = &lfu->segments[link->segment];
+
+    if(link->prev) get_link(lfu, link->prev)->next = link->next;
+    else list->head = link->next;
+    if(link->next) get_link(lfu, link->next)->prev = link->prev;
+    else list->tail = link->prev;
+
+    link->prev = NULL;
+    link->next = NULL;
+    list->size -= get_data_size(data);
+}
+
+/**
+ * Get the victims in eviction order: the probation segment from the tail, then the protected segment.
+ * Referenced entries are skipped.
+ * @param lfu       pointer to the cache
+ * @param data      the previous victim or NULL to get the first one
+ * @return          the data of the next victim or NULL if there are no more
+ */
+static void * get_next_victim(lv_cache_tinylfu_t * lfu, void * data)
+{
+    uint32_t node_size = lfu->cache.node_size;
+    uint32_t segment = SEGMENT_PROBATION;
+
+    if(data) {
+        segment = get_link(lfu, data)->segment;
+        data = get_link(lfu, data)->prev;
+    }
+    else {
+        data = lfu->segments[SEGMENT_PROBATION].tail;
+    }
+
+    while(1) {
+        while(data) {
+            if(lv_cache_entry_get_ref(lv_cache_entry_get_entry(data, node_size)) == 0) return data;
+            data = get_link(lfu, data)->prev;
+        }
+
+        if(segment == SEGMENT_PROTECTED) return NULL;
+        segment = SEGMENT_PROTECTED;
+        data = lfu->segments[SEGMENT_PROTECTED].tail;
+    }
+}
+
+static void sketch_increment(lv_cache_tinylfu_t * lfu, uint32_t hash)
+{
+    uint32_t i;
+    for(i = 0; i < SKETCH_DEPTH; i++) {
+        uint8_t * counter = &lfu->sketch[i][(hash * sketch_seeds[i]) >> (32 - SKETCH_WIDTH_SHIFT)];
+        if(*counter < SKETCH_COUNTER_MAX) (*counter)++;
+    }
+
+    /*Aging: halve every counter periodically so the old accesses count less*/
+    lfu->sketch_add_cnt++;
+    if(lfu->sketch_add_cnt >= SKETCH_SAMPLE_CNT) {
+        lfu->sketch_add_cnt = 0;
+        uint8_t * c = &lfu->sketch[0][0];
+        for(i = 0; i < SKETCH_DEPTH * SKETCH_WIDTH; i++) c[i] >>= 1;
+    }
+}
+
+static uint32_t sketch_estimate(lv_cache_tinylfu_t * lfu, uint32_t hash)
+{
+    uint32_t min = SKETCH_COUNTER_MAX;
+    uint32_t i;
+    for(i = 0; i < SKETCH_DEPTH; i++) {
+        uint32_t v = lfu->sketch[i][(hash * sketch_seeds[i]) >> (32 - SKETCH_WIDTH_SHIFT)];
+        if(v < min) min = v;
+    }
+
+    return min;
+}
@@ -0,0 +1,79 @@
+/**
+* @file lv_cache_tinylfu.h
+*
+*/
+
+#ifndef LV_CACHE_TINYLFU_H
+#define LV_CACHE_TINYLFU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_cache_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Counters of a TinyLFU cache. They are never reset automatically.
+ */
+typedef struct {
+    uint32_t hit_cnt;           /**< Number of lookups which found the entry */
+    uint32_t miss_cnt;          /**< Number of lookups which didn't find the entry */
+    uint32_t admit_cnt;         /**< Number of new entries stored in the cache */
+    uint32_t reject_cnt;        /**< Number of new entries which were not stored as they are used less than the victims */
+    uint32_t evict_cnt;         /**< Number of entries evicted to make room for new ones */
+    uint32_t evict_size;        /**< Total size of the evicted entries (e.g. bytes) */
+} lv_cache_tinylfu_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the counters of a cache created with `lv_cache_class_tinylfu_size`.
+ * @param cache     pointer to a cache
+ * @param stats     store the counters here
+ */
+void lv_cache_tinylfu_get_stats(lv_cache_t * cache, lv_cache_tinylfu_stats_t * stats);
+
+/**
+ * Clear the counters of a cache created with `lv_cache_class_tinylfu_size`.
+ * @param cache     pointer to a cache
+ */
+void lv_cache_tinylfu_reset_stats(lv_cache_t * cache);
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**
+ * Size based cache with a segmented LRU and frequency based admission.
+ * New entries are stored in a probation segment and are moved to a protected segment
+ * when they are used again. An entry is stored only if it was used more often recently
+ * than the entries it would evict together, so large, rarely used entries don't
+ * flush the small, frequently used ones. A rejected entry is still returned by
+ * `lv_cache_add` and is freed when it's released.
+ * Requires `lv_cache_ops_t::hash_cb`.
+ */
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_cache_class_t lv_cache_class_tinylfu_size;
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_CACHE_TINYLFU_H*/
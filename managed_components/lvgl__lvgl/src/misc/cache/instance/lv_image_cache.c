@@ -33,6 +33,7 @@
 
 static lv_cache_compare_res_t image_cache_compare_cb(const lv_image_cache_data_t * lhs,
                                                      const lv_image_cache_data_t * rhs);
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * data);
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data);
 static void iter_inspect_cb(void * elem);
 
@@ -58,11 +59,18 @@ lv_result_t lv_image_cache_init(uint32_t size)
         return LV_RESULT_OK;
     }
 
-    img_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+#if LV_IMAGE_CACHE_TINYLFU
+    const lv_cache_class_t * cache_class = &lv_cache_class_tinylfu_size;
+#else
+    const lv_cache_class_t * cache_class = &lv_cache_class_lru_rb_size;
+#endif
+
+    img_cache_p = lv_cache_create(cache_class,
     sizeof(lv_image_cache_data_t), size, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_cache_compare_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t) image_cache_free_cb,
+        .hash_cb = (lv_cache_hash_cb_t) image_cache_hash_cb,
     });
 
     lv_cache_set_name(img_cache_p, CACHE_NAME);
@@ -115,6 +123,13 @@ void lv_image_cache_dump(void)
     lv_iter_inspect(iter, iter_inspect_cb);
 }
 
+#if LV_IMAGE_CACHE_TINYLFU
+void lv_image_cache_get_stats(lv_cache_tinylfu_stats_t * stats)
+{
+    lv_cache_tinylfu_get_stats(img_cache_p, stats);
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -139,6 +154,26 @@ inline static lv_cache_compare_res_t image_cache_common_compare(const void * lhs
     return lhs_src_type > rhs_src_type ? 1 : -1;
 }
 
+inline static uint32_t image_cache_common_hash(const void * src, lv_image_src_t src_type)
+{
+    /*FNV-1a of the path or of the address. The other sources are equal if their type is equal.*/
+    uint32_t hash = 2166136261u ^ src_type;
+    if(src_type == LV_IMAGE_SRC_FILE) {
+        const uint8_t * c = src;
+        while(*c) hash = (hash ^ *c++) * 16777619u;
+    }
+    else if(src_type == LV_IMAGE_SRC_VARIABLE) {
+        uintptr_t p = (uintptr_t)src;
+        uint32_t i;
+        for(i = 0; i < sizeof(p); i++) {
+            hash = (hash ^ (uint8_t)p) * 16777619u;
+            p >>= 8;
+        }
+    }
+
+    return hash;
+}
+
 static lv_cache_compare_res_t image_cache_compare_cb(
     const lv_image_cache_data_t * lhs,
     const lv_image_cache_data_t * rhs)
@@ -146,6 +181,11 @@ static lv_cache_compare_res_t image_cache_compare_cb(
     return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
 }
 
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * data)
+{
+    return image_cache_common_hash(data->src, data->src_type);
+}
+
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
 {
     LV_UNUSED(user_data);
@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "../../lv_types.h"
+#include "../class/lv_cache_tinylfu.h"
 
 /*********************
  *      DEFINES
@@ -66,6 +67,14 @@ lv_iter_t * lv_image_cache_iter_create(void);
  */
 void lv_image_cache_dump(void);
 
+#if LV_IMAGE_CACHE_TINYLFU
+/**
+ * Get the hit, miss, admission and eviction counters of the image cache.
+ * @param stats     store the counters here
+ */
+void lv_image_cache_get_stats(lv_cache_tinylfu_stats_t * stats);
+#endif
+
 /*************************
  *    GLOBAL VARIABLES
  *************************/
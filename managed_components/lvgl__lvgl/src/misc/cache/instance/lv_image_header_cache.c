@@ -32,6 +32,7 @@
 
 static lv_cache_compare_res_t image_header_cache_compare_cb(const lv_image_header_cache_data_t * lhs,
                                                             const lv_image_header_cache_data_t * rhs);
+static uint32_t image_header_cache_hash_cb(const lv_image_header_cache_data_t * data);
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data);
 static void iter_inspect_cb(void * elem);
 
@@ -57,11 +58,12 @@ lv_result_t lv_image_header_cache_init(uint32_t count)
         return LV_RESULT_OK;
     }
 
-    img_header_cache_p = lv_cache_create(&lv_cache_class_lru_rb_count,
+    img_header_cache_p = lv_cache_create(&lv_cache_class_lru_ht_count,
     sizeof(lv_image_header_cache_data_t), count, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_header_cache_compare_cb,
         .create_cb = NULL,
-        .free_cb = (lv_cache_free_cb_t) image_header_cache_free_cb
+        .free_cb = (lv_cache_free_cb_t) image_header_cache_free_cb,
+        .hash_cb = (lv_cache_hash_cb_t) image_header_cache_hash_cb,
     });
 
     lv_cache_set_name(img_header_cache_p, CACHE_NAME);
@@ -135,6 +137,26 @@ inline static lv_cache_compare_res_t image_cache_common_compare(const void * lhs
     return lhs_src_type > rhs_src_type ? 1 : -1;
 }
 
+inline static uint32_t image_cache_common_hash(const void * src, lv_image_src_t src_type)
+{
+    /*FNV-1a of the path or of the address. The other sources are equal if their type is equal.*/
+    uint32_t hash = 2166136261u ^ src_type;
+    if(src_type == LV_IMAGE_SRC_FILE) {
+        const uint8_t * c = src;
+        while(*c) hash = (hash ^ *c++) * 16777619u;
+    }
+    else if(src_type == LV_IMAGE_SRC_VARIABLE) {
+        uintptr_t p = (uintptr_t)src;
+        uint32_t i;
+        for(i = 0; i < sizeof(p); i++) {
+            hash = (hash ^ (uint8_t)p) * 16777619u;
+            p >>= 8;
+        }
+    }
+
+    return hash;
+}
+
 static lv_cache_compare_res_t image_header_cache_compare_cb(
     const lv_image_header_cache_data_t * lhs,
     const lv_image_header_cache_data_t * rhs)
@@ -142,6 +164,11 @@ static lv_cache_compare_res_t image_header_cache_compare_cb(
     return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
 }
 
+static uint32_t image_header_cache_hash_cb(const lv_image_header_cache_data_t * data)
+{
+    return image_cache_common_hash(data->src, data->src_type);
+}
+
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data)
 {
     LV_UNUSED(user_data); /*Unused*/
@@ -276,6 +276,11 @@ void lv_cache_set_compare_cb(lv_cache_t * cache, lv_cache_compare_cb_t compare_c
     LV_UNUSED(user_data);
     cache->ops.compare_cb = compare_cb;
 }
+void lv_cache_set_hash_cb(lv_cache_t * cache, lv_cache_hash_cb_t hash_cb, void * user_data)
+{
+    LV_UNUSED(user_data);
+    cache->ops.hash_cb = hash_cb;
+}
 void lv_cache_set_create_cb(lv_cache_t * cache, lv_cache_create_cb_t alloc_cb, void * user_data)
 {
     LV_UNUSED(user_data);
@@ -185,6 +185,14 @@ bool lv_cache_is_enabled(lv_cache_t * cache);
  */
 void   lv_cache_set_compare_cb(lv_cache_t * cache, lv_cache_compare_cb_t compare_cb, void * user_data);
 
+/**
+ * Set the hash callback of the cache.
+ * @param cache         The cache object pointer to set the hash callback.
+ * @param hash_cb       The hash callback to set.
+ * @param user_data     A user data pointer.
+ */
+void   lv_cache_set_hash_cb(lv_cache_t * cache, lv_cache_hash_cb_t hash_cb, void * user_data);
+
 /**
  * Set the create callback of the cache.
  * @param cache         The cache object pointer to set the create callback.
@@ -45,6 +45,10 @@ static void anim_mark_list_change(void);
 static void anim_completed_handler(lv_anim_t * a);
 static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1,
                                          int32_t y1, int32_t x2, int32_t y2);
+#if LV_ANIM_BATCH
+static int32_t lv_anim_path_cubic_bezier_lut(const lv_anim_t * a, lv_anim_path_lut_t lut_id, int32_t x1,
+                                             int32_t y1, int32_t x2, int32_t y2);
+#endif
 static void lv_anim_pause_for_internal(lv_anim_t * a, uint32_t ms);
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(const lv_anim_t * a_current);
@@ -79,6 +83,14 @@ void lv_anim_core_init(void)
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+
+#if LV_ANIM_BATCH
+    uint32_t i;
+    for(i = 0; i < LV_ANIM_PATH_LUT_NUM; i++) {
+        lv_free(state.path_lut[i]);
+        state.path_lut[i] = NULL;
+    }
+#endif
 }
 
 void lv_anim_enable_vsync_mode(bool enable)
@@ -294,6 +306,36 @@ int32_t lv_anim_path_linear(const lv_anim_t * a)
     return new_value;
 }
 
+#if LV_ANIM_BATCH
+
+int32_t lv_anim_path_ease_in(const lv_anim_t * a)
+{
+    return lv_anim_path_cubic_bezier_lut(a, LV_ANIM_PATH_LUT_EASE_IN,
+                                         LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+                                         LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1));
+}
+
+int32_t lv_anim_path_ease_out(const lv_anim_t * a)
+{
+    return lv_anim_path_cubic_bezier_lut(a, LV_ANIM_PATH_LUT_EASE_OUT,
+                                         LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
+                                         LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+}
+
+int32_t lv_anim_path_ease_in_out(const lv_anim_t * a)
+{
+    return lv_anim_path_cubic_bezier_lut(a, LV_ANIM_PATH_LUT_EASE_IN_OUT,
+                                         LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+                                         LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+}
+
+int32_t lv_anim_path_overshoot(const lv_anim_t * a)
+{
+    return lv_anim_path_cubic_bezier_lut(a, LV_ANIM_PATH_LUT_OVERSHOOT, 341, 0, 683, 1300);
+}
+
+#else
+
 int32_t lv_anim_path_ease_in(const lv_anim_t * a)
 {
     return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
@@ -317,6 +359,8 @@ int32_t lv_anim_path_overshoot(const lv_anim_t * a)
     return lv_anim_path_cubic_bezier(a, 341, 0, 683, 1300);
 }
 
+#endif /*LV_ANIM_BATCH*/
+
 int32_t lv_anim_path_bounce(const lv_anim_t * a)
 {
     /*Calculate the current step*/
@@ -756,6 +800,41 @@ static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1, int32_
     return new_value;
 }
 
+#if LV_ANIM_BATCH
+/**
+ * The same as `lv_anim_path_cubic_bezier` but the steps are read from a table
+ * which is filled on the first use of the path.
+ * The Newton iteration of `lv_cubic_bezier` is done only once per `t` this way.
+ */
+static int32_t lv_anim_path_cubic_bezier_lut(const lv_anim_t * a, lv_anim_path_lut_t lut_id, int32_t x1,
+                                             int32_t y1, int32_t x2, int32_t y2)
+{
+    int16_t * lut = state.path_lut[lut_id];
+    if(lut == NULL) {
+        lut = lv_malloc((LV_BEZIER_VAL_MAX + 1) * sizeof(int16_t));
+        if(lut == NULL) return lv_anim_path_cubic_bezier(a, x1, y1, x2, y2);
+
+        int32_t t;
+        for(t = 0; t <= LV_BEZIER_VAL_MAX; t++) {
+            lut[t] = (int16_t)lv_cubic_bezier(t, x1, y1, x2, y2);
+        }
+        state.path_lut[lut_id] = lut;
+    }
+
+    /*Calculate the current step*/
+    uint32_t t = lv_map(a->act_time, 0, a->duration, 0, LV_BEZIER_VAL_MAX);
+    if(t > LV_BEZIER_VAL_MAX) return lv_anim_path_cubic_bezier(a, x1, y1, x2, y2);
+    int32_t step = lut[t];
+
+    int32_t new_value;
+    new_value = step * (a->end_value - a->start_value);
+    new_value = new_value >> LV_BEZIER_VAL_SHIFT;
+    new_value += a->start_value;
+
+    return new_value;
+}
+#endif
+
 static void lv_anim_pause_for_internal(lv_anim_t * a, uint32_t ms)
 {
 
@@ -24,12 +24,26 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_ANIM_BATCH
+/** Built-in paths which are evaluated from a lookup table*/
+typedef enum {
+    LV_ANIM_PATH_LUT_EASE_IN,
+    LV_ANIM_PATH_LUT_EASE_OUT,
+    LV_ANIM_PATH_LUT_EASE_IN_OUT,
+    LV_ANIM_PATH_LUT_OVERSHOOT,
+    LV_ANIM_PATH_LUT_NUM,
+} lv_anim_path_lut_t;
+#endif
+
 typedef struct {
     bool anim_list_changed;
     bool anim_run_round;
     bool anim_vsync_registered;
     lv_timer_t * timer;
     lv_ll_t anim_ll;
+#if LV_ANIM_BATCH
+    int16_t * path_lut[LV_ANIM_PATH_LUT_NUM];   /**< Step of the path for every `t` in [0..LV_BEZIER_VAL_MAX]*/
+#endif
 } lv_anim_state_t;
 
 /**********************
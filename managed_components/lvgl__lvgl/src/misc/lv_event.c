@@ -35,6 +35,8 @@ static void event_mark_deleting(lv_event_list_t * list, lv_event_dsc_t * dsc);
 static bool event_is_marked_deleting(lv_event_dsc_t * dsc);
 static uint32_t event_array_size(lv_event_list_t * list);
 static lv_event_dsc_t ** event_array_at(lv_event_list_t * list, uint32_t index);
+static uint64_t event_code_bit(uint32_t code);
+static void update_code_mask(lv_event_list_t * list);
 
 /**********************
  *  STATIC VARIABLES
@@ -97,6 +99,9 @@ lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preproces
     if(list == NULL) return LV_RESULT_OK;
     if(e->deleted) return LV_RESULT_INVALID;
 
+    /*Most of the events (e.g. the drawing events) have no handlers in the list*/
+    if((list->code_mask & (event_code_bit(e->code) | event_code_bit(LV_EVENT_ALL))) == 0) return LV_RESULT_OK;
+
     /* When obj is deleted in its own event, it will cause the `list->array` header to be released,
      * but the content still exists, which leads to memory leakage.
      * Therefore, back up the header in advance,
@@ -156,6 +161,7 @@ lv_event_dsc_t * lv_event_add(lv_event_list_t * list, lv_event_cb_t cb, lv_event
     }
 
     lv_array_push_back(&list->array, &dsc);
+    list->code_mask |= event_code_bit(filter);
     return dsc;
 }
 
@@ -419,6 +425,7 @@ static void cleanup_event_list(lv_event_list_t * list)
     if(list->has_marked_deleting == false) return;
 
     cleanup_event_list_core(&list->array);
+    update_code_mask(list);
 
     list->has_marked_deleting = false;
 }
@@ -440,3 +447,26 @@ static lv_event_dsc_t ** event_array_at(lv_event_list_t * list, uint32_t index)
 {
     return lv_array_at(&list->array, index);
 }
+
+/**
+ * Get the bit of an event code in `code_mask`.
+ * The last bit is shared by the last codes of `lv_event_code_t` and the registered event codes.
+ */
+static uint64_t event_code_bit(uint32_t code)
+{
+    code &= ~LV_EVENT_PREPROCESS;
+    if(code > 63) code = 63;
+    return (uint64_t)1 << code;
+}
+
+static void update_code_mask(lv_event_list_t * list)
+{
+    uint64_t mask = 0;
+    const uint32_t size = event_array_size(list);
+    for(uint32_t i = 0; i < size; i++) {
+        lv_event_dsc_t * dsc = *event_array_at(list, i);
+        mask |= event_code_bit(dsc->filter);
+    }
+
+    list->code_mask = mask;
+}
@@ -127,6 +127,8 @@ typedef enum {
 
 typedef struct {
     lv_array_t array;
+    uint64_t code_mask;                /**< A bit for each event code which has a handler in the list.
+                                         Bit 0 is `LV_EVENT_ALL`, the last bit is shared by the rest of the codes. */
     uint8_t is_traversing: 1;          /**< True: the list is being nested traversed */
     uint8_t has_marked_deleting: 1;    /**< True: the list has marked deleting objects
                                          when some of events are marked as deleting */
@@ -20,6 +20,13 @@
 #define lv_style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define last_custom_prop_id LV_GLOBAL_DEFAULT()->style_last_custom_prop_id
 
+/*The values cached in the resolved style cache of the objects might change*/
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    #define resolved_cache_invalidate() LV_GLOBAL_DEFAULT()->style_resolved_gen++
+#else
+    #define resolved_cache_invalidate()
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -194,6 +201,8 @@ void lv_style_reset(lv_style_t * style)
 {
     LV_ASSERT_STYLE(style);
 
+    resolved_cache_invalidate();
+
     if(style->prop_cnt != 255) lv_free(style->values_and_props);
     lv_memzero(style, sizeof(lv_style_t));
 #if LV_USE_ASSERT_STYLE
@@ -295,6 +304,8 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 
     if(style->prop_cnt == 0)  return false;
 
+    resolved_cache_invalidate();
+
     LV_PROFILER_STYLE_BEGIN;
 
     uint8_t * tmp = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
@@ -348,6 +359,7 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
 
     LV_ASSERT(prop != LV_STYLE_PROP_INV);
     LV_PROFILER_STYLE_BEGIN;
+    resolved_cache_invalidate();
     lv_style_prop_t * props;
     int32_t i;
 
@@ -20,6 +20,7 @@
 
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
+#define SCHED_ARRAY_SIZE_MIN 8
 
 #define state LV_GLOBAL_DEFAULT()->timer_state
 #define timer_ll_p &(state.timer_ll)
@@ -28,12 +29,28 @@
  *      TYPEDEFS
  **********************/
 
+typedef enum {
+    SCHED_NONE = 0,     /*Paused or being executed*/
+    SCHED_HEAP,         /*Waiting for its deadline*/
+    SCHED_DUE,          /*Can run now or needs to be deleted*/
+} sched_type_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+static int64_t tick_get_ext(void);
+static void timer_schedule(lv_timer_t * timer);
+static void timer_unschedule(lv_timer_t * timer);
+static lv_timer_t * timer_get_next_due(bool from_head, uint32_t seq_prev);
+static bool sched_array_reserve(lv_timer_t *** array, uint32_t * size, uint32_t cnt);
+static void heap_insert(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_set(uint32_t id, lv_timer_t * timer);
+static void due_add(lv_timer_t * timer);
+static void due_remove(lv_timer_t * timer);
 
 /**********************
  *  STATIC VARIABLES
@@ -90,42 +107,49 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
+    /*Run the due timers in the order of the list (from the newest to the oldest).
+     *If a timer was created or deleted by a timer, start from the newest due timer again.*/
     lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            timer_active = next; /*Load the next timer*/
+    bool from_head = true;
+    uint32_t seq_prev = 0;
+    state_p->timer_deleted             = false;
+    state_p->timer_created             = false;
+
+    while((timer_active = timer_get_next_due(from_head, seq_prev)) != NULL) {
+        from_head = false;
+        seq_prev = timer_active->seq;
+
+        /*Reschedule it after the execution according to its new state*/
+        timer_unschedule(timer_active);
+        state_p->timer_exec = timer_active;
+
+        bool exec = lv_timer_exec(timer_active);
+
+        /*The timer might be deleted if it runs only once ('repeat_count = 1')*/
+        if(state_p->timer_exec) timer_schedule(timer_active);
+        state_p->timer_exec = NULL;
+
+        if(exec && (state_p->timer_created || state_p->timer_deleted)) {
+            LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
+            from_head = true;
+            state_p->timer_deleted             = false;
+            state_p->timer_created             = false;
         }
-    } while(timer_active);
+    }
 
+    /*The due timers are in `due`, the earliest of the others is the root of the heap*/
     uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
-        }
+    uint32_t i;
+    for(i = 0; i < state_p->due_cnt; i++) {
+        uint32_t delay = lv_timer_time_remaining(state_p->due[i]);
+        if(delay < time_until_next)
+            time_until_next = delay;
+    }
 
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
+    if(state_p->heap_cnt) {
+        uint32_t delay = lv_timer_time_remaining(state_p->heap[0]);
+        if(delay < time_until_next)
+            time_until_next = delay;
     }
 
     state_p->busy_time += lv_tick_elaps(handler_start);
@@ -177,6 +201,9 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
+    new_timer->sched_type = SCHED_NONE;
+    new_timer->seq = ++state.timer_seq;
+    timer_schedule(new_timer);
 
     state.timer_created = true;
 
@@ -193,6 +220,9 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+    timer_unschedule(timer);
+    if(state.timer_exec == timer) state.timer_exec = NULL;
+
     lv_ll_remove(timer_ll_p, timer);
     state.timer_deleted = true;
 
@@ -203,12 +233,14 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+    timer_unschedule(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+    timer_schedule(timer);
     lv_timer_handler_resume();
 }
 
@@ -216,18 +248,21 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    timer_schedule(timer);
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    timer_schedule(timer);
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+    timer_schedule(timer);
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -246,6 +281,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    timer_schedule(timer);
     lv_timer_handler_resume();
 }
 
@@ -260,6 +296,15 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_cnt = 0;
+    state.heap_size = 0;
+    lv_free(state.due);
+    state.due = NULL;
+    state.due_cnt = 0;
+    state.due_size = 0;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -386,3 +431,167 @@ void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+/**
+ * Get the current tick on a time line which doesn't wrap around.
+ * Assumes that it's called at least once in every 49 days (e.g. by `lv_timer_handler`).
+ * @return the current tick extended to 64 bit
+ */
+static int64_t tick_get_ext(void)
+{
+    uint32_t tick = lv_tick_get();
+    if(tick < state.tick_last) state.tick_wrap_cnt++;
+    state.tick_last = tick;
+
+    return ((int64_t)state.tick_wrap_cnt << 32) + tick;
+}
+
+/**
+ * Update the deadline of a timer and put it into the heap or among the due timers.
+ * Needs to be called when anything changes which can affect when the timer runs.
+ * @param timer pointer to lv_timer
+ */
+static void timer_schedule(lv_timer_t * timer)
+{
+    timer_unschedule(timer);
+    if(timer->paused) return;
+
+    int64_t now = tick_get_ext();
+    timer->deadline = now - lv_tick_diff((uint32_t)now, timer->last_run) + timer->period;
+
+    /*If the repeat count is over `lv_timer_exec` deletes or pauses it*/
+    if(timer->repeat_count == 0 || timer->deadline <= now) due_add(timer);
+    else heap_insert(timer);
+}
+
+/**
+ * Remove a timer from the heap or from the due timers.
+ * @param timer pointer to lv_timer
+ */
+static void timer_unschedule(lv_timer_t * timer)
+{
+    if(timer->sched_type == SCHED_HEAP) heap_remove(timer);
+    else if(timer->sched_type == SCHED_DUE) due_remove(timer);
+}
+
+/**
+ * Get the due timer which is next in the list.
+ * @param from_head     true: start from the newest timer
+ * @param seq_prev      if not `from_head` return only timers older than this
+ * @return              the newest due timer after `seq_prev` or NULL if there is no such timer
+ */
+static lv_timer_t * timer_get_next_due(bool from_head, uint32_t seq_prev)
+{
+    /*Collect the timers whose deadline has passed*/
+    int64_t now = tick_get_ext();
+    while(state.heap_cnt && state.heap[0]->deadline <= now) {
+        lv_timer_t * timer = state.heap[0];
+        heap_remove(timer);
+        due_add(timer);
+    }
+
+    lv_timer_t * next = NULL;
+    uint32_t i;
+    for(i = 0; i < state.due_cnt; i++) {
+        lv_timer_t * timer = state.due[i];
+        if(!from_head && (int32_t)(timer->seq - seq_prev) >= 0) continue;
+        if(next == NULL || (int32_t)(timer->seq - next->seq) > 0) next = timer;
+    }
+
+    return next;
+}
+
+/**
+ * Make sure that an array of timer pointers can store `cnt` elements.
+ * @param array     pointer to the array
+ * @param size      pointer to the current size of the array. Updated if the array grows.
+ * @param cnt       the required number of elements
+ * @return          true: success; false: out of memory
+ */
+static bool sched_array_reserve(lv_timer_t *** array, uint32_t * size, uint32_t cnt)
+{
+    if(cnt <= *size) return true;
+
+    uint32_t new_size = *size ? *size * 2 : SCHED_ARRAY_SIZE_MIN;
+    lv_timer_t ** new_array = lv_realloc(*array, new_size * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(new_array);
+    if(new_array == NULL) return false;
+
+    *array = new_array;
+    *size = new_size;
+    return true;
+}
+
+static void heap_insert(lv_timer_t * timer)
+{
+    if(!sched_array_reserve(&state.heap, &state.heap_size, state.heap_cnt + 1)) return;
+
+    /*Move the parents down until the right place is found*/
+    uint32_t id = state.heap_cnt;
+    state.heap_cnt++;
+    while(id > 0) {
+        uint32_t parent_id = (id - 1) / 2;
+        if(state.heap[parent_id]->deadline <= timer->deadline) break;
+        heap_set(id, state.heap[parent_id]);
+        id = parent_id;
+    }
+
+    heap_set(id, timer);
+    timer->sched_type = SCHED_HEAP;
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    timer->sched_type = SCHED_NONE;
+    state.heap_cnt--;
+    if(timer->sched_id == state.heap_cnt) return;
+
+    /*Put the last timer to the place of the removed one and restore the heap order*/
+    lv_timer_t * last = state.heap[state.heap_cnt];
+    uint32_t id = timer->sched_id;
+    while(id > 0) {
+        uint32_t parent_id = (id - 1) / 2;
+        if(state.heap[parent_id]->deadline <= last->deadline) break;
+        heap_set(id, state.heap[parent_id]);
+        id = parent_id;
+    }
+
+    while(1) {
+        uint32_t child_id = id * 2 + 1;
+        if(child_id >= state.heap_cnt) break;
+        if(child_id + 1 < state.heap_cnt &&
+           state.heap[child_id + 1]->deadline < state.heap[child_id]->deadline) child_id++;
+        if(last->deadline <= state.heap[child_id]->deadline) break;
+        heap_set(id, state.heap[child_id]);
+        id = child_id;
+    }
+
+    heap_set(id, last);
+}
+
+static void heap_set(uint32_t id, lv_timer_t * timer)
+{
+    state.heap[id] = timer;
+    timer->sched_id = id;
+}
+
+static void due_add(lv_timer_t * timer)
+{
+    if(!sched_array_reserve(&state.due, &state.due_size, state.due_cnt + 1)) return;
+
+    state.due[state.due_cnt] = timer;
+    timer->sched_id = state.due_cnt;
+    timer->sched_type = SCHED_DUE;
+    state.due_cnt++;
+}
+
+static void due_remove(lv_timer_t * timer)
+{
+    timer->sched_type = SCHED_NONE;
+    state.due_cnt--;
+
+    /*Move the last one to the place of the removed timer*/
+    lv_timer_t * last = state.due[state.due_cnt];
+    state.due[timer->sched_id] = last;
+    last->sched_id = timer->sched_id;
+}
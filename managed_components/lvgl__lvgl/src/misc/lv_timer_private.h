@@ -35,11 +35,26 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     volatile int paused;
     uint32_t auto_delete : 1;
+    uint32_t sched_type : 2;   /**< Where the scheduler stores the timer, see `sched_id` */
+    uint32_t sched_id;         /**< Index in the heap or in the array of due timers */
+    uint32_t seq;              /**< Creation order. The timers run from the newest to the oldest. */
+    int64_t deadline;          /**< `last_run + period` on the wrap around free time line of the scheduler */
 };
 
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
 
+    lv_timer_t ** heap;        /**< Min-heap of the waiting timers ordered by `deadline` */
+    uint32_t heap_cnt;
+    uint32_t heap_size;
+    lv_timer_t ** due;         /**< Timers which can run (or be deleted) now, in no specific order */
+    uint32_t due_cnt;
+    uint32_t due_size;
+    lv_timer_t * timer_exec;   /**< The timer being executed. Set to NULL if it's deleted meanwhile. */
+    uint32_t timer_seq;
+    uint32_t tick_last;
+    uint32_t tick_wrap_cnt;
+
     bool lv_timer_run;
     uint8_t idle_last;
     bool timer_deleted;
@@ -120,6 +120,8 @@ typedef struct _lv_layer_t lv_layer_t;
 typedef struct _lv_draw_unit_t lv_draw_unit_t;
 typedef struct _lv_draw_task_t lv_draw_task_t;
 
+typedef struct _lv_draw_task_grid_t lv_draw_task_grid_t;
+
 typedef struct _lv_indev_t lv_indev_t;
 
 typedef struct _lv_event_t lv_event_t;
@@ -138,6 +140,12 @@ typedef struct _lv_font_info_t lv_font_info_t;
 
 typedef struct _lv_font_manager_t lv_font_manager_t;
 
+typedef struct _lv_font_glyph_cache_stats_t lv_font_glyph_cache_stats_t;
+
+typedef struct _lv_font_fmt_txt_cmap_index_t lv_font_fmt_txt_cmap_index_t;
+
+typedef struct _lv_font_fmt_txt_kern_index_t lv_font_fmt_txt_kern_index_t;
+
 typedef struct _lv_image_decoder_t lv_image_decoder_t;
 
 typedef struct _lv_image_decoder_dsc_t lv_image_decoder_dsc_t;
@@ -184,6 +192,8 @@ typedef struct _lv_obj_style_t lv_obj_style_t;
 
 typedef struct _lv_obj_style_transition_dsc_t lv_obj_style_transition_dsc_t;
 
+typedef struct _lv_obj_style_resolved_cache_t lv_obj_style_resolved_cache_t;
+
 typedef struct _lv_hit_test_info_t lv_hit_test_info_t;
 
 typedef struct _lv_cover_check_info_t lv_cover_check_info_t;
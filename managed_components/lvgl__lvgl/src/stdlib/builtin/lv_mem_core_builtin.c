@@ -38,6 +38,13 @@
 #endif
 #define state LV_GLOBAL_DEFAULT()->tlsf_state
 
+#if LV_MEM_SLAB_SIZE_MAX
+    #if LV_MEM_SLAB_SIZE_MAX % 8 || LV_MEM_SLAB_SIZE_MAX > LV_MEM_SLAB_PAGE_SIZE
+        #error "LV_MEM_SLAB_SIZE_MAX must be a multiple of 8 and not larger than LV_MEM_SLAB_PAGE_SIZE"
+    #endif
+    #define SLAB_PAGE_NONE  0xFFFF
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,6 +53,17 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
+static void * malloc_unlocked(size_t size);
+static void free_unlocked(void * p);
+static size_t block_size(void * p);
+#if LV_MEM_SLAB_SIZE_MAX
+static void slab_init(void);
+static void * slab_alloc(size_t size);
+static void slab_free(void * p);
+static bool slab_owns(const void * p);
+static uint32_t slab_get_block_size(const void * p);
+static void slab_monitor(lv_mem_monitor_t * mon_p);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -93,6 +111,10 @@ void lv_mem_init(void)
     LV_ASSERT_MALLOC(pool_p);
     *pool_p = lv_tlsf_get_pool(state.tlsf);
 
+#if LV_MEM_SLAB_SIZE_MAX
+    slab_init();
+#endif
+
 #if LV_MEM_ADD_JUNK
     LV_LOG_WARN("LV_MEM_ADD_JUNK is enabled which makes LVGL much slower");
 #endif
@@ -141,12 +163,7 @@ void * lv_malloc_core(size_t size)
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
-    void * p = lv_tlsf_malloc(state.tlsf, size);
-
-    if(p) {
-        state.cur_used += lv_tlsf_block_size(p);
-        state.max_used = LV_MAX(state.cur_used, state.max_used);
-    }
+    void * p = malloc_unlocked(size);
 
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -160,6 +177,28 @@ void * lv_realloc_core(void * p, size_t new_size)
     lv_mutex_lock(&state.mutex);
 #endif
 
+#if LV_MEM_SLAB_SIZE_MAX
+    if(p == NULL || slab_owns(p) || new_size <= LV_MEM_SLAB_SIZE_MAX) {
+        size_t old_size = p ? block_size(p) : 0;
+        void * p_new;
+        /*Keep the block if the new size belongs to the same size class*/
+        if(p && slab_owns(p) && new_size <= old_size && new_size + 8 > old_size) {
+            p_new = p;
+        }
+        else {
+            p_new = malloc_unlocked(new_size);
+            if(p_new && p) {
+                lv_memcpy(p_new, p, LV_MIN(old_size, new_size));
+                free_unlocked(p);
+            }
+        }
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        return p_new;
+    }
+#endif
+
     size_t old_size = lv_tlsf_block_size(p);
     void * p_new = lv_tlsf_realloc(state.tlsf, p, new_size);
 
@@ -181,13 +220,7 @@ void lv_free_core(void * p)
     lv_mutex_lock(&state.mutex);
 #endif
 
-#if LV_MEM_ADD_JUNK
-    lv_memset(p, 0xbb, lv_tlsf_block_size(data));
-#endif
-    size_t size = lv_tlsf_block_size(p);
-    lv_tlsf_free(state.tlsf, p);
-    if(state.cur_used > size) state.cur_used -= size;
-    else state.cur_used = 0;
+    free_unlocked(p);
 
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -205,6 +238,10 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
         lv_tlsf_walk_pool(*pool_p, lv_mem_walker, mon_p);
     }
 
+#if LV_MEM_SLAB_SIZE_MAX
+    slab_monitor(mon_p);
+#endif
+
     mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
     if(mon_p->free_size > 0) {
         mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
@@ -270,4 +307,225 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
             mon_p->free_biggest_size = size;
     }
 }
+
+static void * malloc_unlocked(size_t size)
+{
+    void * p = NULL;
+    size_t size_used = 0;
+#if LV_MEM_SLAB_SIZE_MAX
+    if(size <= LV_MEM_SLAB_SIZE_MAX) {
+        p = slab_alloc(size);
+        if(p) size_used = (size + 7) & ~(size_t)7;
+        else state.slab_fallback_cnt++;
+    }
+    if(p == NULL)
+#endif
+    {
+        p = lv_tlsf_malloc(state.tlsf, size);
+        if(p) size_used = lv_tlsf_block_size(p);
+    }
+
+    state.cur_used += size_used;
+    state.max_used = LV_MAX(state.cur_used, state.max_used);
+
+    return p;
+}
+
+static void free_unlocked(void * p)
+{
+    size_t size = block_size(p);
+#if LV_MEM_ADD_JUNK
+    lv_memset(p, 0xbb, size);
+#endif
+
+#if LV_MEM_SLAB_SIZE_MAX
+    if(slab_owns(p)) slab_free(p);
+    else
+#endif
+    {
+        lv_tlsf_free(state.tlsf, p);
+    }
+
+    if(state.cur_used > size) state.cur_used -= size;
+    else state.cur_used = 0;
+}
+
+static size_t block_size(void * p)
+{
+#if LV_MEM_SLAB_SIZE_MAX
+    if(slab_owns(p)) return slab_get_block_size(p);
+#endif
+    return lv_tlsf_block_size(p);
+}
+
+#if LV_MEM_SLAB_SIZE_MAX
+
+static void slab_list_remove(uint16_t * head, uint16_t page_id)
+{
+    lv_mem_slab_page_t * page = &state.slab_pages[page_id];
+    if(page->prev != SLAB_PAGE_NONE) state.slab_pages[page->prev].next = page->next;
+    else *head = page->next;
+    if(page->next != SLAB_PAGE_NONE) state.slab_pages[page->next].prev = page->prev;
+}
+
+static void slab_list_push(uint16_t * head, uint16_t page_id)
+{
+    lv_mem_slab_page_t * page = &state.slab_pages[page_id];
+    page->prev = SLAB_PAGE_NONE;
+    page->next = *head;
+    if(*head != SLAB_PAGE_NONE) state.slab_pages[*head].prev = page_id;
+    *head = page_id;
+}
+
+static bool slab_page_is_full(const lv_mem_slab_page_t * page)
+{
+    uint32_t size = (page->class_id + 1) * 8;
+    return page->free_head == NULL && page->carved + size > LV_MEM_SLAB_PAGE_SIZE;
+}
+
+/**
+ * Take the pool of the pages from the heap and put all pages to the list of free pages.
+ * If there is not enough memory the slabs are not used.
+ */
+static void slab_init(void)
+{
+    state.slab_free_head = SLAB_PAGE_NONE;
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        state.slab_classes[i].partial_head = SLAB_PAGE_NONE;
+    }
+
+    state.slab_pool = lv_tlsf_malloc(state.tlsf, LV_MEM_SLAB_PAGE_CNT * LV_MEM_SLAB_PAGE_SIZE);
+    if(state.slab_pool == NULL) {
+        LV_LOG_WARN("couldn't allocate the pool of the slabs");
+        return;
+    }
+
+    for(i = LV_MEM_SLAB_PAGE_CNT; i > 0; i--) {
+        slab_list_push(&state.slab_free_head, i - 1);
+    }
+}
+
+/**
+ * Allocate a block from the size class of `size`.
+ * Blocks are taken from the free list of the first page with free blocks
+ * or cut from the not used end of the page, so it needs no loop.
+ * @param size      1..LV_MEM_SLAB_SIZE_MAX
+ * @return          the block or NULL if there are no more pages
+ */
+static void * slab_alloc(size_t size)
+{
+    uint32_t class_id = (size + 7) / 8 - 1;
+    uint32_t size_class = (class_id + 1) * 8;
+    lv_mem_slab_class_t * cls = &state.slab_classes[class_id];
+
+    uint16_t page_id = cls->partial_head;
+    if(page_id == SLAB_PAGE_NONE) {
+        page_id = state.slab_free_head;
+        if(page_id == SLAB_PAGE_NONE) return NULL;
+
+        slab_list_remove(&state.slab_free_head, page_id);
+        lv_mem_slab_page_t * page = &state.slab_pages[page_id];
+        page->free_head = NULL;
+        page->carved = 0;
+        page->used_cnt = 0;
+        page->class_id = class_id;
+        slab_list_push(&cls->partial_head, page_id);
+        cls->page_cnt++;
+    }
+
+    lv_mem_slab_page_t * page = &state.slab_pages[page_id];
+    void * p;
+    if(page->free_head) {
+        p = page->free_head;
+        page->free_head = *(void **)p;
+    }
+    else {
+        p = state.slab_pool + page_id * LV_MEM_SLAB_PAGE_SIZE + page->carved;
+        page->carved += size_class;
+    }
+
+    page->used_cnt++;
+    cls->used_cnt++;
+
+    if(slab_page_is_full(page)) slab_list_remove(&cls->partial_head, page_id);
+
+    return p;
+}
+
+/**
+ * Give back a block to its page. Empty pages are given back to the free pages
+ * so that they can be used by any size class.
+ * @param p         a block allocated by `slab_alloc`
+ */
+static void slab_free(void * p)
+{
+    uint32_t page_id = ((uintptr_t)p - (uintptr_t)state.slab_pool) / LV_MEM_SLAB_PAGE_SIZE;
+    lv_mem_slab_page_t * page = &state.slab_pages[page_id];
+    lv_mem_slab_class_t * cls = &state.slab_classes[page->class_id];
+    bool was_full = slab_page_is_full(page);
+
+    *(void **)p = page->free_head;
+    page->free_head = p;
+    page->used_cnt--;
+    cls->used_cnt--;
+
+    if(page->used_cnt == 0) {
+        if(!was_full) slab_list_remove(&cls->partial_head, page_id);
+        slab_list_push(&state.slab_free_head, page_id);
+        cls->page_cnt--;
+    }
+    else if(was_full) {
+        slab_list_push(&cls->partial_head, page_id);
+    }
+}
+
+static bool slab_owns(const void * p)
+{
+    /*Also false if there is no pool as the offset from NULL is larger than the pool*/
+    return (uintptr_t)p - (uintptr_t)state.slab_pool < LV_MEM_SLAB_PAGE_CNT * LV_MEM_SLAB_PAGE_SIZE;
+}
+
+static uint32_t slab_get_block_size(const void * p)
+{
+    uint32_t page_id = ((uintptr_t)p - (uintptr_t)state.slab_pool) / LV_MEM_SLAB_PAGE_SIZE;
+    return (state.slab_pages[page_id].class_id + 1) * 8;
+}
+
+/**
+ * Add the statistics of the size classes. The pool is a used block for TLSF,
+ * so replace it with the allocated blocks and count its not allocated part as free.
+ * @param mon_p     the TLSF statistics to update
+ */
+static void slab_monitor(lv_mem_monitor_t * mon_p)
+{
+    if(state.slab_pool == NULL) return;
+
+    uint32_t used_size = 0;
+    uint32_t used_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        lv_mem_slab_monitor_t * slab_mon = &mon_p->slab[i];
+        const lv_mem_slab_class_t * cls = &state.slab_classes[i];
+        slab_mon->block_size = (i + 1) * 8;
+        slab_mon->page_cnt = cls->page_cnt;
+        slab_mon->used_cnt = cls->used_cnt;
+        slab_mon->free_cnt = cls->page_cnt * (LV_MEM_SLAB_PAGE_SIZE / slab_mon->block_size) - cls->used_cnt;
+        used_size += cls->used_cnt * slab_mon->block_size;
+        used_cnt += cls->used_cnt;
+    }
+
+    uint16_t page_id;
+    for(page_id = state.slab_free_head; page_id != SLAB_PAGE_NONE; page_id = state.slab_pages[page_id].next) {
+        mon_p->slab_free_page_cnt++;
+    }
+
+    mon_p->slab_fallback_cnt = state.slab_fallback_cnt;
+    mon_p->used_cnt += used_cnt;
+    mon_p->used_cnt--;  /*The pool itself*/
+    mon_p->free_size += LV_MEM_SLAB_PAGE_CNT * LV_MEM_SLAB_PAGE_SIZE - used_size;
+}
+
+#endif /*LV_MEM_SLAB_SIZE_MAX*/
+
 #endif /*LV_STDLIB_BUILTIN*/
@@ -23,10 +23,33 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_MEM_SLAB_SIZE_MAX
+#define LV_MEM_SLAB_CLASS_CNT   (LV_MEM_SLAB_SIZE_MAX / 8)
+#define LV_MEM_SLAB_PAGE_SIZE   512
+#define LV_MEM_SLAB_PAGE_CNT    (LV_MEM_SLAB_POOL_SIZE / LV_MEM_SLAB_PAGE_SIZE)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_MEM_SLAB_SIZE_MAX
+typedef struct {
+    void * free_head;       /**< Freed blocks. The first word of a free block points to the next one.*/
+    uint16_t carved;        /**< Bytes from the start of the page which were already given out*/
+    uint16_t used_cnt;      /**< Allocated blocks*/
+    uint16_t prev;          /**< Neighbors in the list of the class or of the free pages*/
+    uint16_t next;
+    uint8_t class_id;
+} lv_mem_slab_page_t;
+
+typedef struct {
+    uint16_t partial_head;  /**< Pages with free blocks*/
+    uint16_t page_cnt;
+    uint32_t used_cnt;
+} lv_mem_slab_class_t;
+#endif
+
 typedef struct {
 #if LV_USE_OS
     lv_mutex_t mutex;
@@ -35,6 +58,13 @@ typedef struct {
     size_t cur_used;
     size_t max_used;
     lv_ll_t  pool_ll;
+#if LV_MEM_SLAB_SIZE_MAX
+    uint8_t * slab_pool;
+    uint16_t slab_free_head;
+    uint32_t slab_fallback_cnt;
+    lv_mem_slab_class_t slab_classes[LV_MEM_SLAB_CLASS_CNT];
+    lv_mem_slab_page_t slab_pages[LV_MEM_SLAB_PAGE_CNT];
+#endif
 } lv_tlsf_state_t;
 
 /**********************
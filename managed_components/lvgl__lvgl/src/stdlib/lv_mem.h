@@ -29,6 +29,20 @@ extern "C" {
 
 typedef void * lv_mem_pool_t;
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+#if LV_MEM_SLAB_SIZE_MAX
+/**
+ * Information about a slab size class.
+ */
+typedef struct {
+    uint16_t block_size;    /**< Size of the blocks of the class */
+    uint16_t page_cnt;      /**< Number of pages used by the class */
+    uint32_t used_cnt;      /**< Number of allocated blocks */
+    uint32_t free_cnt;      /**< Number of free blocks on the pages of the class */
+} lv_mem_slab_monitor_t;
+#endif
+#endif
+
 /**
  * Heap information structure.
  */
@@ -41,6 +55,13 @@ typedef struct {
     size_t max_used;    /**< Max size of Heap memory used */
     uint8_t used_pct;   /**< Percentage used */
     uint8_t frag_pct;   /**< Amount of fragmentation */
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+#if LV_MEM_SLAB_SIZE_MAX
+    lv_mem_slab_monitor_t slab[LV_MEM_SLAB_SIZE_MAX / 8];   /**< Size classes. Also counted in `used_cnt` and `free_size` */
+    uint32_t slab_free_page_cnt;    /**< Pages not used by any class */
+    uint32_t slab_fallback_cnt;     /**< Small allocations served by the heap because the pool was full */
+#endif
+#endif
 } lv_mem_monitor_t;
 
 /**********************
@@ -30,7 +30,12 @@ extern "C" {
 #define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
+#define LV_MEM_SLAB_SIZE_MAX    128
+#define LV_MEM_SLAB_POOL_SIZE   (16 * 1024U)
 #define LV_OBJ_STYLE_CACHE      1
+#define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE 64
+#define LV_OBJ_STYLE_RESOLVED_CACHE_MEM_MAX (64 * 1024)
+#define LV_ANIM_BATCH           1
 #define LV_BIN_DECODER_RAM_LOAD 0
 #endif
 
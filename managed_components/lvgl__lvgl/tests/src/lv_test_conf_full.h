@@ -45,6 +45,9 @@
 #define LV_FONT_DEFAULT         &lv_font_montserrat_14
 #define LV_FONT_FMT_TXT_LARGE   1
 #define LV_USE_FONT_COMPRESSED  1
+#define LV_FONT_GLYPH_CACHE_SIZE (8 * 1024)
+#define LV_FONT_FMT_TXT_CMAP_INDEX 1
+#define LV_FONT_FMT_TXT_KERN_INDEX 1
 #define LV_USE_BIDI 1
 #define LV_USE_ARABIC_PERSIAN_CHARS 1
 #define LV_USE_PERF_MONITOR         1
@@ -138,6 +141,7 @@
 #define LV_USE_OBJ_NAME         1
 
 #define LV_CACHE_DEF_SIZE       (10 * 1024 * 1024)
+#define LV_IMAGE_CACHE_TINYLFU  1
 
 #ifndef LV_USE_LINUX_DRM
     #define LV_USE_LINUX_DRM    1
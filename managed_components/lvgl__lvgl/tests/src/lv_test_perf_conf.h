@@ -578,6 +578,9 @@
         #define LV_FONT_UNSCII_8  0
         #define LV_FONT_UNSCII_16 0
 
+        /** CJK fonts for the glyph lookup benchmark */
+        #define LV_FONT_SOURCE_HAN_SANS_SC_16_CJK 1
+
         /** Optionally declare custom fonts here.
         *
         *  You can use any of these fonts as the default font too and they will be available
@@ -600,6 +603,12 @@
         /** Enables/disables support for compressed fonts. */
         #define LV_USE_FONT_COMPRESSED 0
 
+        /** Glyph-id lookup tables for the sparse cmaps */
+        #define LV_FONT_FMT_TXT_CMAP_INDEX 1
+
+        /** Hash tables for the kerning pairs */
+        #define LV_FONT_FMT_TXT_KERN_INDEX 1
+
         /** Enable drawing placeholders when glyph dsc is not found. */
         #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -43,6 +43,17 @@ static lv_cache_compare_res_t compare_cb(const test_data_t * lhs,
     return 0;
 }
 
+static uint32_t hash_cb(const test_data_t * node)
+{
+    return ((uint32_t)node->key1 * 31 + (uint32_t)node->key2) * 2654435761u;
+}
+
+/*Many keys with the same hash to test the probing*/
+static uint32_t weak_hash_cb(const test_data_t * node)
+{
+    return (uint32_t)node->key1 % 4;
+}
+
 static void free_cb(test_data_t * node, void * user_data)
 {
     LV_UNUSED(user_data);
@@ -56,6 +67,7 @@ static lv_cache_t * create_cache(const lv_cache_class_t * cache_class,
         .compare_cb = (lv_cache_compare_cb_t)compare_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t)free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)hash_cb,
     };
     return lv_cache_create(cache_class, sizeof(test_data_t), max_size, ops);
 }
@@ -272,6 +284,76 @@ void test_cache_lru_ll_count_eviction(void)
     lv_cache_destroy(cache, NULL);
 }
 
+void test_cache_lru_ht_count_add_acquire(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_ht_count, CACHE_EXPECTED_DATA_CNT);
+    test_data_t expected_data[CACHE_EXPECTED_DATA_CNT];
+    cache_add_acquire_test(cache, expected_data, CACHE_EXPECTED_DATA_CNT);
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_lru_ht_count_eviction(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_ht_count, CACHE_EXPECTED_DATA_CNT);
+    test_data_t expected_data[CACHE_EXPECTED_DATA_CNT];
+    cache_eviction_test(cache, expected_data, CACHE_EXPECTED_DATA_CNT);
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_lru_ht_collisions_and_drops(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_ht_count, 64);
+    TEST_ASSERT_NOT_NULL(cache);
+    lv_cache_set_hash_cb(cache, (lv_cache_hash_cb_t)weak_hash_cb, NULL);
+
+    /*Grows the table a few times*/
+    int32_t i;
+    for(i = 0; i < 64; i++) {
+        test_data_t search_key = { .key1 = i, .key2 = -i };
+        lv_cache_entry_t * entry = lv_cache_add(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+
+    /*Drop every third entry. The remaining ones need to be found in the middle of the probe sequences.*/
+    for(i = 0; i < 64; i += 3) {
+        test_data_t search_key = { .key1 = i, .key2 = -i };
+        lv_cache_drop(cache, &search_key, NULL);
+    }
+
+    for(i = 0; i < 64; i++) {
+        test_data_t search_key = { .key1 = i, .key2 = -i };
+        lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+        if(i % 3 == 0) {
+            TEST_ASSERT_NULL(entry);
+            continue;
+        }
+
+        TEST_ASSERT_NOT_NULL(entry);
+        TEST_ASSERT_EQUAL(i, ((test_data_t *)lv_cache_entry_get_data(entry))->key1);
+        lv_cache_release(cache, entry, NULL);
+    }
+
+    /*Evict in LRU order: 1 and 2 were used the longest time ago*/
+    for(i = 100; i < 100 + 22 + 2; i++) {
+        test_data_t search_key = { .key1 = i, .key2 = -i };
+        lv_cache_entry_t * entry = lv_cache_add(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+
+    test_data_t search_key1 = { .key1 = 1, .key2 = -1 };
+    TEST_ASSERT_NULL(lv_cache_acquire(cache, &search_key1, NULL));
+    test_data_t search_key2 = { .key1 = 2, .key2 = -2 };
+    TEST_ASSERT_NULL(lv_cache_acquire(cache, &search_key2, NULL));
+    test_data_t search_key4 = { .key1 = 4, .key2 = -4 };
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key4, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_cache_release(cache, entry, NULL);
+
+    lv_cache_destroy(cache, NULL);
+}
+
 void test_cache_sc_da_eviction_second_chance_spares_referenced_entries(void)
 {
     lv_cache_t * cache = create_cache(&lv_cache_class_sc_da, CACHE_EXPECTED_DATA_CNT);
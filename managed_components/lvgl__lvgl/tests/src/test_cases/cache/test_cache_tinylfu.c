@@ -0,0 +1,206 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CACHE_SIZE_BYTES    1000
+#define ICON_CNT            8
+#define ICON_SIZE           50
+
+static uint32_t MEM_SIZE = 0;
+static uint32_t free_cnt;
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+    void * data; // malloced data
+    int32_t key;
+} test_data_t;
+
+static lv_cache_compare_res_t compare_cb(const test_data_t * lhs, const test_data_t * rhs)
+{
+    if(lhs->key != rhs->key) {
+        return lhs->key > rhs->key ? 1 : -1;
+    }
+    return 0;
+}
+
+static uint32_t hash_cb(const test_data_t * node)
+{
+    return (uint32_t)node->key * 2654435761u;
+}
+
+static void free_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(node->data);
+    free_cnt++;
+}
+
+static lv_cache_t * cache;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    MEM_SIZE = lv_test_get_free_mem();
+    free_cnt = 0;
+
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)hash_cb,
+    };
+    cache = lv_cache_create(&lv_cache_class_tinylfu_size, sizeof(test_data_t), CACHE_SIZE_BYTES, ops);
+    TEST_ASSERT_NOT_NULL(cache);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_cache_destroy(cache, NULL);
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(MEM_SIZE, 64);
+}
+
+/*Look up the key and add it on miss, as an image decoder does. Keep the entry acquired.*/
+static lv_cache_entry_t * use(int32_t key, uint32_t size)
+{
+    test_data_t search_key = { .slot.size = size, .key = key };
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    if(entry) return entry;
+
+    entry = lv_cache_add(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    test_data_t * data = lv_cache_entry_get_data(entry);
+    data->data = lv_malloc(size);
+    return entry;
+}
+
+static void use_and_release(int32_t key, uint32_t size)
+{
+    lv_cache_release(cache, use(key, size), NULL);
+}
+
+static bool is_cached(int32_t key)
+{
+    test_data_t search_key = { .key = key };
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    if(entry == NULL) return false;
+    lv_cache_release(cache, entry, NULL);
+    return true;
+}
+
+static void use_icons(uint32_t cnt)
+{
+    uint32_t i, j;
+    for(i = 0; i < cnt; i++) {
+        for(j = 0; j < ICON_CNT; j++) use_and_release(j, ICON_SIZE);
+    }
+}
+
+void test_cache_tinylfu_large_one_shot_entries_keep_the_hot_ones(void)
+{
+    use_icons(3);
+    TEST_ASSERT_EQUAL(ICON_CNT * ICON_SIZE, lv_cache_get_size(cache, NULL));
+
+    /*Wallpapers shown once. They are returned but not stored.*/
+    int32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_cache_entry_t * entry = use(100 + i, 800);
+        test_data_t * data = lv_cache_entry_get_data(entry);
+        TEST_ASSERT_EQUAL_INT32(100 + i, data->key);
+        TEST_ASSERT_NOT_NULL(data->data);
+        lv_cache_release(cache, entry, NULL);
+    }
+
+    TEST_ASSERT_EQUAL(5, free_cnt);
+    TEST_ASSERT_EQUAL(ICON_CNT * ICON_SIZE, lv_cache_get_size(cache, NULL));
+    for(i = 0; i < ICON_CNT; i++) TEST_ASSERT_TRUE(is_cached(i));
+    TEST_ASSERT_FALSE(is_cached(100));
+
+    lv_cache_tinylfu_stats_t stats;
+    lv_cache_tinylfu_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_UINT32(ICON_CNT, stats.admit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(5, stats.reject_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.evict_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * ICON_CNT + ICON_CNT, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(ICON_CNT + 5 + 1, stats.miss_cnt);
+}
+
+void test_cache_tinylfu_frequently_used_large_entry_is_admitted(void)
+{
+    use_icons(1);
+
+    /*Used more often than the icons it evicts together*/
+    uint32_t i;
+    for(i = 0; i < 10 && !is_cached(100); i++) {
+        use_and_release(100, 800);
+    }
+
+    TEST_ASSERT_TRUE(is_cached(100));
+    TEST_ASSERT_LESS_OR_EQUAL(CACHE_SIZE_BYTES, lv_cache_get_size(cache, NULL));
+
+    lv_cache_tinylfu_stats_t stats;
+    lv_cache_tinylfu_get_stats(cache, &stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.reject_cnt);
+    /*8 * 50 + 800 - 1000 = 200 bytes were needed*/
+    TEST_ASSERT_EQUAL_UINT32(4, stats.evict_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4 * ICON_SIZE, stats.evict_size);
+
+    lv_cache_tinylfu_reset_stats(cache);
+    lv_cache_tinylfu_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+}
+
+void test_cache_tinylfu_referenced_entries_are_not_evicted(void)
+{
+    lv_cache_entry_t * entries[ICON_CNT];
+    uint32_t i;
+    for(i = 0; i < ICON_CNT; i++) entries[i] = use(i, 120);
+
+    /*No victim, but the new entry is still returned*/
+    lv_cache_entry_t * entry = use(100, 200);
+    for(i = 0; i < 10; i++) {
+        lv_cache_release(cache, entry, NULL);
+        entry = use(100, 200);
+    }
+    TEST_ASSERT_NOT_NULL(lv_cache_entry_get_data(entry));
+    lv_cache_release(cache, entry, NULL);
+    TEST_ASSERT_FALSE(is_cached(100));
+
+    for(i = 0; i < ICON_CNT; i++) TEST_ASSERT_TRUE(is_cached(i));
+
+    /*Dropped while used: freed only when released*/
+    test_data_t search_key = { .key = 0 };
+    lv_cache_drop(cache, &search_key, NULL);
+    TEST_ASSERT_FALSE(is_cached(0));
+    uint32_t free_cnt_dropped = free_cnt;
+    lv_cache_release(cache, entries[0], NULL);
+    TEST_ASSERT_EQUAL(free_cnt_dropped + 1, free_cnt);
+
+    for(i = 1; i < ICON_CNT; i++) lv_cache_release(cache, entries[i], NULL);
+}
+
+void test_cache_tinylfu_iterator_lists_every_entry(void)
+{
+    use_icons(2);
+    use_and_release(50, 100);
+
+    lv_iter_t * iter = lv_cache_iter_create(cache);
+    TEST_ASSERT_NOT_NULL(iter);
+
+    uint64_t elem[(sizeof(test_data_t) + 64) / 8];
+    uint32_t cnt = 0;
+    uint32_t key_sum = 0;
+    while(lv_iter_next(iter, elem) == LV_RESULT_OK) {
+        key_sum += ((test_data_t *)elem)->key;
+        cnt++;
+    }
+    lv_iter_destroy(iter);
+
+    TEST_ASSERT_EQUAL_UINT32(ICON_CNT + 1, cnt);
+    TEST_ASSERT_EQUAL_UINT32(50 + ICON_CNT * (ICON_CNT - 1) / 2, key_sum);
+}
+
+#endif
@@ -15,6 +15,7 @@ void tearDown(void)
 {
     /* Function run after every test */
     lv_obj_clean(lv_screen_active());
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_XRGB8888);
 }
 
 static lv_obj_t * label_create(const lv_font_t * font, lv_style_t * style, const char * text_base)
@@ -78,6 +79,84 @@ void test_draw_label_color_and_opa(void)
     all_labels_create("color_and_opa", &style);
 }
 
+/*Glyphs clipped on all sides at various bit offsets of the packed bitmaps*/
+static void clipped_labels_create(const char * name)
+{
+    LV_FONT_DECLARE(test_font_montserrat_ascii_1bpp);
+    LV_FONT_DECLARE(test_font_montserrat_ascii_2bpp);
+    LV_FONT_DECLARE(test_font_montserrat_ascii_4bpp);
+    const lv_font_t * fonts[] = {
+        &test_font_montserrat_ascii_1bpp,
+        &test_font_montserrat_ascii_2bpp,
+        &test_font_montserrat_ascii_4bpp,
+#if LV_FONT_UNSCII_16
+        &lv_font_unscii_16,
+#endif
+    };
+
+    uint32_t i;
+    for(i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        int32_t ofs;
+        for(ofs = 0; ofs < 4; ofs++) {
+            lv_obj_t * cont = lv_obj_create(lv_screen_active());
+            lv_obj_remove_style_all(cont);
+            lv_obj_set_size(cont, 161 + ofs, 9 + ofs);
+
+            lv_obj_t * label = lv_label_create(cont);
+            lv_label_set_text(label, "Clipped: 0123456789 AVWM");
+            lv_obj_set_style_text_font(label, fonts[i], 0);
+            lv_obj_set_style_text_opa(label, ofs % 2 ? LV_OPA_70 : LV_OPA_COVER, 0);
+            lv_obj_set_pos(label, -ofs - 1, -ofs - 2);
+        }
+    }
+
+    char buf[64];
+    lv_snprintf(buf, sizeof(buf), "draw/label_%s.png", name);
+    TEST_ASSERT_EQUAL_SCREENSHOT(buf);
+}
+
+void test_draw_label_l8(void)
+{
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_L8);
+    all_labels_create("l8_normal", NULL);
+}
+
+void test_draw_label_l8_opa(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_text_opa(&style, LV_OPA_50);
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_L8);
+    all_labels_create("l8_opa", &style);
+}
+
+void test_draw_label_l8_clipped(void)
+{
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_L8);
+    clipped_labels_create("l8_clipped");
+}
+
+void test_draw_label_i1(void)
+{
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_I1);
+    all_labels_create("i1_normal", NULL);
+}
+
+void test_draw_label_i1_opa(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_text_opa(&style, LV_OPA_70);
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_I1);
+    all_labels_create("i1_opa", &style);
+}
+
+void test_draw_label_i1_clipped(void)
+{
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_I1);
+    clipped_labels_create("i1_clipped");
+}
+
 static lv_obj_t * decor_label_create(lv_text_decor_t decor, lv_text_align_t align, lv_opa_t opa)
 {
     lv_color_t color = lv_palette_main(LV_PALETTE_BLUE);
@@ -0,0 +1,121 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE
+
+static void create_ui(void)
+{
+    lv_obj_set_flex_flow(lv_screen_active(), LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(obj, 120, 80);
+        lv_obj_t * label = lv_label_create(obj);
+        lv_label_set_text_fmt(label, "Item %" LV_PRIu32, i);
+    }
+}
+
+void test_draw_task_arena_steady_state_has_no_heap_allocation(void)
+{
+    create_ui();
+
+    /*Let the arena grow to its working size*/
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+
+    lv_draw_task_arena_stats_t stats;
+    lv_draw_task_arena_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(0, stats.chunk_cnt);
+
+    lv_draw_task_arena_reset_stats();
+    for(i = 0; i < 5; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+
+    lv_draw_task_arena_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(40, stats.task_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.heap_alloc_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(5, stats.reset_cnt);
+    TEST_ASSERT_GREATER_THAN(0, stats.used_max);
+}
+
+void test_draw_task_arena_tail_is_kept_up_to_date(void)
+{
+    static uint8_t buf[LV_CANVAS_BUF_SIZE(40, 40, 32, LV_DRAW_BUF_STRIDE_ALIGN)];
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_buffer(canvas, buf, 40, 40, LV_COLOR_FORMAT_ARGB8888);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    lv_area_t area = {0, 0, 9, 9};
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_draw_rect(&layer, &dsc, &area);
+        lv_area_move(&area, 10, 10);
+    }
+
+    lv_draw_task_t * t = layer.draw_task_head;
+    TEST_ASSERT_NOT_NULL(t);
+    while(t->next) t = t->next;
+    TEST_ASSERT_EQUAL_PTR(t, layer.draw_task_tail);
+    TEST_ASSERT_EQUAL_INT32(20, t->area.x1);
+
+    lv_canvas_finish_layer(canvas, &layer);
+    TEST_ASSERT_NULL(layer.draw_task_head);
+
+    /*A new task has to become both the head and the tail*/
+    lv_draw_rect(&layer, &dsc, &area);
+    TEST_ASSERT_NOT_NULL(layer.draw_task_head);
+    TEST_ASSERT_EQUAL_PTR(layer.draw_task_head, layer.draw_task_tail);
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+void test_draw_task_arena_rewinds_when_last_task_is_freed(void)
+{
+    lv_draw_task_arena_reset_stats();
+
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    lv_area_t area = {0, 0, 9, 9};
+    lv_draw_task_t * t = lv_draw_add_task(&layer, &area, LV_DRAW_TASK_TYPE_FILL);
+    TEST_ASSERT_EQUAL_UINT8(1, t->in_arena);
+
+    lv_draw_task_arena_stats_t stats;
+    lv_draw_task_arena_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.task_cnt);
+
+    /*Mark it finished so that the next dispatch frees it and rewinds the arena*/
+    t->state = LV_DRAW_TASK_STATE_FINISHED;
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_NULL(layer.draw_task_head);
+
+    lv_draw_task_arena_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.reset_cnt);
+}
+
+#endif /*LV_DRAW_TASK_ARENA_CHUNK_SIZE*/
+
+#endif
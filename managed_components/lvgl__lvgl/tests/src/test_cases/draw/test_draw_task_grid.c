@@ -0,0 +1,188 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define TASK_CNT    300
+
+static lv_layer_t layer;
+static uint32_t rnd_seed;
+
+/*The grid is used only with more than one draw unit. Add one which never takes draw tasks.*/
+static int32_t dummy_unit_dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * l)
+{
+    LV_UNUSED(draw_unit);
+    LV_UNUSED(l);
+    return LV_DRAW_UNIT_IDLE;
+}
+
+static void add_dummy_unit(void)
+{
+    if(lv_draw_get_unit_count() > 1) return;
+    lv_draw_unit_t * unit = lv_draw_create_unit(sizeof(lv_draw_unit_t));
+    unit->name = "DUMMY";
+    unit->dispatch_cb = dummy_unit_dispatch;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    add_dummy_unit();
+    rnd_seed = 0x1234;
+    lv_layer_init(&layer);
+    lv_area_set(&layer.buf_area, 0, 0, 479, 319);
+    layer._clip_area = layer.buf_area;
+    layer.phy_clip_area = layer.buf_area;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+}
+
+#if LV_DRAW_TASK_GRID_LEVELS
+
+static uint32_t rnd(uint32_t max)
+{
+    rnd_seed = rnd_seed * 1103515245 + 12345;
+    return (rnd_seed >> 16) % max;
+}
+
+static void add_random_tasks(uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_area_t a;
+        /*Mostly small areas, some outside of the layer and some large ones*/
+        a.x1 = (int32_t)rnd(540) - 30;
+        a.y1 = (int32_t)rnd(380) - 30;
+        int32_t max_size = rnd(10) == 0 ? 300 : 40;
+        a.x2 = a.x1 + rnd(max_size);
+        a.y2 = a.y1 + rnd(max_size);
+
+        lv_draw_task_t * t = lv_draw_add_task(&layer, &a, LV_DRAW_TASK_TYPE_FILL);
+        lv_draw_finalize_task_creation(&layer, t);
+    }
+}
+
+static void randomize_states(void)
+{
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        uint32_t r = rnd(10);
+        if(r < 6) t->state = LV_DRAW_TASK_STATE_WAITING;
+        else if(r < 8) t->state = LV_DRAW_TASK_STATE_QUEUED;
+        else t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+        t->preferred_draw_unit_id = 1 + rnd(2);
+        t = t->next;
+    }
+}
+
+/*The reference: check all older draw tasks*/
+static bool is_independent_ref(lv_draw_task_t * t_check, uint8_t draw_unit_id)
+{
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t != t_check) {
+        if(t->state != LV_DRAW_TASK_STATE_FINISHED &&
+           !(t->state == LV_DRAW_TASK_STATE_QUEUED && t->preferred_draw_unit_id == draw_unit_id)) {
+            lv_area_t a;
+            if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) return false;
+        }
+        t = t->next;
+    }
+    return true;
+}
+
+static lv_draw_task_t * get_next_available_ref(lv_draw_task_t * t_prev, uint8_t draw_unit_id)
+{
+    lv_draw_task_t * t = t_prev ? t_prev->next : layer.draw_task_head;
+    while(t) {
+        if((t->preferred_draw_unit_id == draw_unit_id || t->preferred_draw_unit_id == LV_DRAW_UNIT_NONE) &&
+           t->state == LV_DRAW_TASK_STATE_WAITING &&
+           is_independent_ref(t, draw_unit_id)) {
+            return t;
+        }
+        t = t->next;
+    }
+    return NULL;
+}
+
+void test_draw_task_grid_is_created_only_for_many_tasks(void)
+{
+    add_random_tasks(LV_DRAW_TASK_GRID_MIN_TASKS - 1);
+    TEST_ASSERT_NULL(layer.draw_task_grid);
+
+    add_random_tasks(1);
+    TEST_ASSERT_NOT_NULL(layer.draw_task_grid);
+
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        TEST_ASSERT_EQUAL_UINT8(1, t->in_grid);
+        t = t->next;
+    }
+
+    /*Removing all draw tasks deletes the grid*/
+    tearDown();
+    TEST_ASSERT_NULL(layer.draw_task_head);
+    TEST_ASSERT_NULL(layer.draw_task_grid);
+    TEST_ASSERT_EQUAL_UINT32(0, layer.draw_task_seq);
+}
+
+void test_draw_task_grid_finds_the_same_tasks_as_a_full_scan(void)
+{
+    add_random_tasks(TASK_CNT);
+    TEST_ASSERT_NOT_NULL(layer.draw_task_grid);
+
+    uint32_t round;
+    for(round = 0; round < 20; round++) {
+        randomize_states();
+
+        uint8_t unit_id;
+        for(unit_id = 1; unit_id <= 2; unit_id++) {
+            lv_draw_task_t * t_ref = NULL;
+            lv_draw_task_t * t = NULL;
+            do {
+                t_ref = get_next_available_ref(t_ref, unit_id);
+                t = lv_draw_get_next_available_task(&layer, t, unit_id);
+                TEST_ASSERT_EQUAL_PTR(t_ref, t);
+            } while(t);
+        }
+    }
+}
+
+void test_draw_task_grid_is_updated_when_tasks_are_removed(void)
+{
+    add_random_tasks(TASK_CNT);
+
+    /*Finish every 3rd draw task and remove them from the layer.
+     *Mark the others as in progress to not let the SW draw unit take them.*/
+    uint32_t i = 0;
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = i % 3 == 0 ? LV_DRAW_TASK_STATE_FINISHED : LV_DRAW_TASK_STATE_IN_PROGRESS;
+        t = t->next;
+        i++;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_NOT_NULL(layer.draw_task_grid);
+
+    randomize_states();
+    lv_draw_task_t * t_ref = NULL;
+    t = NULL;
+    do {
+        t_ref = get_next_available_ref(t_ref, 1);
+        t = lv_draw_get_next_available_task(&layer, t, 1);
+        TEST_ASSERT_EQUAL_PTR(t_ref, t);
+    } while(t);
+}
+
+#endif /*LV_DRAW_TASK_GRID_LEVELS*/
+
+#endif
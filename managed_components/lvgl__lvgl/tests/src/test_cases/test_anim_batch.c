@@ -0,0 +1,137 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t inv_cnt;
+
+static void invalidate_area_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    inv_cnt++;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_refr_now(NULL);
+    inv_cnt = 0;
+    lv_display_add_event_cb(lv_display_get_default(), invalidate_area_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), invalidate_area_cb, NULL);
+    lv_anim_delete_all();
+    lv_obj_clean(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+#if LV_ANIM_BATCH
+
+static void bg_color_cb(void * var, int32_t v)
+{
+    lv_obj_set_style_bg_color(var, lv_color_make(v, 0, 0), 0);
+}
+
+static void border_color_cb(void * var, int32_t v)
+{
+    lv_obj_set_style_border_color(var, lv_color_make(0, v, 0), 0);
+}
+
+static void opa_cb(void * var, int32_t v)
+{
+    lv_obj_set_style_opa(var, v, 0);
+}
+
+static void start_anim(lv_obj_t * obj, lv_anim_exec_xcb_t exec_cb)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, obj);
+    lv_anim_set_values(&a, 0, 255);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_duration(&a, 1000);
+    lv_anim_start(&a);
+}
+
+static void run_anims(uint32_t ms)
+{
+    lv_tick_inc(ms);
+    lv_anim_refr_now();
+}
+
+static int32_t ref_path(const lv_anim_t * a, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    int32_t t = lv_map(a->act_time, 0, a->duration, 0, LV_BEZIER_VAL_MAX);
+    int32_t step = lv_cubic_bezier(t, x1, y1, x2, y2);
+    return ((step * (a->end_value - a->start_value)) >> LV_BEZIER_VAL_SHIFT) + a->start_value;
+}
+
+void test_anim_batch_path_lut_matches_the_bezier_curve(void)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, -50, 300);
+    lv_anim_set_duration(&a, 777);
+
+    for(a.act_time = 0; a.act_time <= (int32_t)a.duration; a.act_time++) {
+        TEST_ASSERT_EQUAL_INT32(ref_path(&a, LV_BEZIER_VAL_FLOAT(0.42), 0, LV_BEZIER_VAL_MAX, LV_BEZIER_VAL_MAX),
+                                lv_anim_path_ease_in(&a));
+        TEST_ASSERT_EQUAL_INT32(ref_path(&a, 0, 0, LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_MAX),
+                                lv_anim_path_ease_out(&a));
+        TEST_ASSERT_EQUAL_INT32(ref_path(&a, LV_BEZIER_VAL_FLOAT(0.42), 0, LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_MAX),
+                                lv_anim_path_ease_in_out(&a));
+        TEST_ASSERT_EQUAL_INT32(ref_path(&a, 341, 0, 683, 1300), lv_anim_path_overshoot(&a));
+    }
+}
+
+void test_anim_batch_object_is_invalidated_once_per_frame(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_pos(obj, 10, 10);
+    lv_refr_now(NULL);
+    inv_cnt = 0;
+
+    start_anim(obj, bg_color_cb);
+    start_anim(obj, border_color_cb);
+    start_anim(obj, opa_cb);
+
+    run_anims(100);
+    TEST_ASSERT_EQUAL_UINT32(1, inv_cnt);
+    TEST_ASSERT_EQUAL_UINT8(lv_obj_get_style_opa(obj, 0), 25);
+
+    /*The next frame is invalidated again*/
+    lv_refr_now(NULL);
+    run_anims(100);
+    TEST_ASSERT_EQUAL_UINT32(2, inv_cnt);
+}
+
+void test_anim_batch_moved_object_is_invalidated_again(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_pos(obj, 10, 10);
+    lv_refr_now(NULL);
+    inv_cnt = 0;
+
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x00ff00), 0);
+    TEST_ASSERT_EQUAL_UINT32(1, inv_cnt);
+
+    /*The new area needs to be invalidated for the next change*/
+    lv_obj_set_x(obj, 100);
+    lv_obj_update_layout(obj);
+    uint32_t inv_cnt_moved = inv_cnt;
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x0000ff), 0);
+    TEST_ASSERT_EQUAL_UINT32(inv_cnt_moved + 1, inv_cnt);
+
+    /*Layout properties are not batched*/
+    lv_obj_set_style_width(obj, 50, 0);
+    TEST_ASSERT_GREATER_THAN_UINT32(inv_cnt_moved + 1, inv_cnt);
+}
+
+#endif /*LV_ANIM_BATCH*/
+
+#endif
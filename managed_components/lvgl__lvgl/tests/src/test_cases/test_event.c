@@ -177,4 +177,51 @@ void test_event_remove_event_cb(void)
     lv_obj_delete(obj);
 }
 
+static uint32_t mask_cb_cnt;
+
+static void mask_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    mask_cb_cnt++;
+}
+
+void test_event_code_mask_follows_the_handlers(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    mask_cb_cnt = 0;
+
+    lv_obj_add_event_cb(obj, mask_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(obj, mask_cb, LV_EVENT_DRAW_MAIN | LV_EVENT_PREPROCESS, NULL);
+    lv_event_list_t * list = &obj->spec_attr->event_list;
+    TEST_ASSERT_EQUAL_UINT64(((uint64_t)1 << LV_EVENT_CLICKED) | ((uint64_t)1 << LV_EVENT_DRAW_MAIN), list->code_mask);
+
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    lv_obj_send_event(obj, LV_EVENT_PRESSED, NULL);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, mask_cb_cnt);
+
+    /*The bit is cleared only when the last handler of the code is removed*/
+    lv_obj_add_event_cb(obj, test_event_cb_1, LV_EVENT_CLICKED, NULL);
+    lv_obj_remove_event_cb(obj, mask_cb);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)1 << LV_EVENT_CLICKED, list->code_mask);
+
+    lv_obj_remove_event_cb(obj, test_event_cb_1);
+    TEST_ASSERT_EQUAL_UINT64(0, list->code_mask);
+
+    /*Handlers of all events and of registered events*/
+    uint32_t my_event = lv_event_register_id();
+    lv_obj_add_event_cb(obj, mask_cb, my_event, NULL);
+    mask_cb_cnt = 0;
+    lv_obj_send_event(obj, my_event, NULL);
+    lv_obj_send_event(obj, LV_EVENT_PRESSED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, mask_cb_cnt);
+
+    lv_obj_add_event_cb(obj, mask_cb, LV_EVENT_ALL, NULL);
+    mask_cb_cnt = 0;
+    lv_obj_send_event(obj, LV_EVENT_PRESSED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, mask_cb_cnt);
+
+    lv_obj_delete(obj);
+}
+
 #endif
@@ -0,0 +1,130 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX && LV_FONT_SOURCE_HAN_SANS_SC_14_CJK && LV_FONT_SOURCE_HAN_SANS_SC_16_CJK
+
+#define LAST_LETTER     0x1FFFF
+
+static uint32_t gids[LAST_LETTER + 1];
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static uint32_t get_gid(const lv_font_t * font, uint32_t letter)
+{
+    lv_font_glyph_dsc_t g;
+    if(!lv_font_get_glyph_dsc_fmt_txt(font, &g, letter, 0)) return 0;
+    return g.gid.index;
+}
+
+static void test_same_glyphs(const lv_font_t * font)
+{
+    uint32_t letter;
+
+    /*Binary search*/
+    TEST_ASSERT_EQUAL_UINT32(0, lv_font_fmt_txt_cmap_index_get_size(font));
+    for(letter = 0; letter <= LAST_LETTER; letter++) {
+        gids[letter] = get_gid(font, letter);
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_font_fmt_txt_cmap_index_create(font));
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_font_fmt_txt_cmap_index_get_size(font));
+
+    for(letter = 0; letter <= LAST_LETTER; letter++) {
+        TEST_ASSERT_EQUAL_UINT32(gids[letter], get_gid(font, letter));
+    }
+
+    lv_font_fmt_txt_cmap_index_delete(font);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_font_fmt_txt_cmap_index_get_size(font));
+}
+
+void test_font_cmap_index_same_glyphs(void)
+{
+    test_same_glyphs(&lv_font_source_han_sans_sc_14_cjk);
+    test_same_glyphs(&lv_font_source_han_sans_sc_16_cjk);
+    test_same_glyphs(&lv_font_montserrat_14);
+}
+
+void test_font_cmap_index_multiple_fonts(void)
+{
+    const lv_font_t * font_14 = &lv_font_source_han_sans_sc_14_cjk;
+    const lv_font_t * font_16 = &lv_font_source_han_sans_sc_16_cjk;
+
+    uint32_t gid_14 = get_gid(font_14, 0x4E2D);
+    uint32_t gid_16 = get_gid(font_16, 0x4E2D);
+    TEST_ASSERT_NOT_EQUAL(0, gid_14);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_font_fmt_txt_cmap_index_create(font_14));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_font_fmt_txt_cmap_index_create(font_16));
+
+    /*Creating it again doesn't build a new table*/
+    uint32_t size = lv_font_fmt_txt_cmap_index_get_size(font_14);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_font_fmt_txt_cmap_index_create(font_14));
+    TEST_ASSERT_EQUAL_UINT32(size, lv_font_fmt_txt_cmap_index_get_size(font_14));
+
+    /*Alternate the fonts*/
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_UINT32(gid_14, get_gid(font_14, 0x4E2D));
+        TEST_ASSERT_EQUAL_UINT32(gid_16, get_gid(font_16, 0x4E2D));
+    }
+
+    lv_font_fmt_txt_cmap_index_delete(font_14);
+    TEST_ASSERT_EQUAL_UINT32(gid_14, get_gid(font_14, 0x4E2D));
+    TEST_ASSERT_EQUAL_UINT32(gid_16, get_gid(font_16, 0x4E2D));
+    lv_font_fmt_txt_cmap_index_delete(font_16);
+}
+
+void test_font_cmap_index_binfont(void)
+{
+    /*The tables of the loaded fonts are built automatically*/
+    lv_font_t * font = lv_binfont_create("A:src/test_assets/test_font_1.fnt");
+    TEST_ASSERT_NOT_NULL(font);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_font_fmt_txt_cmap_index_get_size(font));
+    lv_binfont_destroy(font);
+}
+
+void test_font_cmap_index_other_font(void)
+{
+    lv_font_t font;
+    lv_memzero(&font, sizeof(font));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_font_fmt_txt_cmap_index_create(&font));
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_font_cmap_index_same_glyphs(void)
+{
+}
+
+void test_font_cmap_index_multiple_fonts(void)
+{
+}
+
+void test_font_cmap_index_binfont(void)
+{
+}
+
+void test_font_cmap_index_other_font(void)
+{
+}
+
+#endif
+
+#endif
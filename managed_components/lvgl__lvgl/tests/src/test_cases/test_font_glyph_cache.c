@@ -0,0 +1,148 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_FONT_GLYPH_CACHE_SIZE && LV_USE_SNAPSHOT
+
+static lv_obj_t * label;
+
+void setUp(void)
+{
+    label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_14, 0);
+    lv_label_set_text(label, "0123456789");
+
+    lv_font_fmt_txt_glyph_cache_drop_all();
+    lv_font_fmt_txt_glyph_cache_reset_stats();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void refresh(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+static uint32_t get_referenced_cnt(void)
+{
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->font_glyph_cache;
+    lv_iter_t * iter = lv_cache_iter_create(cache);
+    TEST_ASSERT_NOT_NULL(iter);
+
+    uint8_t * elem = lv_malloc(lv_cache_entry_get_size(cache->node_size));
+    uint32_t cnt = 0;
+    while(lv_iter_next(iter, elem) == LV_RESULT_OK) {
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(elem, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) > 0) cnt++;
+    }
+    lv_free(elem);
+    lv_iter_destroy(iter);
+    return cnt;
+}
+
+void test_font_glyph_cache_hits_on_redraw(void)
+{
+    lv_font_glyph_cache_stats_t stats;
+
+    refresh();
+    lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+
+    refresh();
+    lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.hit_cnt);
+
+    /*The entries are released after drawing*/
+    TEST_ASSERT_EQUAL_UINT32(0, get_referenced_cnt());
+
+    lv_font_fmt_txt_glyph_cache_reset_stats();
+    lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+}
+
+void test_font_glyph_cache_same_rendering(void)
+{
+    lv_obj_t * label2 = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label2, &lv_font_unscii_16, 0);
+    lv_label_set_text(label2, "12:34 Hello");
+    lv_obj_align(label2, LV_ALIGN_CENTER, 0, 0);
+
+    /*Expand the glyphs to the draw unit's buffer*/
+    lv_font_fmt_txt_glyph_cache_deinit();
+    lv_draw_buf_t * uncached = lv_snapshot_take(label2, LV_COLOR_FORMAT_ARGB8888);
+    lv_font_fmt_txt_glyph_cache_init();
+    TEST_ASSERT_NOT_NULL(uncached);
+
+    /*Expand them into the cache and draw them from there*/
+    lv_draw_buf_t * cached = lv_snapshot_take(label2, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(cached);
+    lv_draw_buf_t * hit = lv_snapshot_take(label2, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(hit);
+
+    lv_font_glyph_cache_stats_t stats;
+    lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.hit_cnt);
+
+    TEST_ASSERT_EQUAL_UINT32(uncached->data_size, cached->data_size);
+    TEST_ASSERT_EQUAL_MEMORY(uncached->data, cached->data, uncached->data_size);
+    TEST_ASSERT_EQUAL_MEMORY(uncached->data, hit->data, uncached->data_size);
+
+    lv_draw_buf_destroy(uncached);
+    lv_draw_buf_destroy(cached);
+    lv_draw_buf_destroy(hit);
+}
+
+void test_font_glyph_cache_stays_in_budget(void)
+{
+    char txt[96];
+    uint32_t i;
+    for(i = 0; i < 95; i++) txt[i] = (char)(' ' + i);
+    txt[95] = '\0';
+
+    lv_obj_set_width(label, 400);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_MODE_WRAP);
+    lv_label_set_text(label, txt);
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_28, 0);
+
+    refresh();
+    refresh();
+
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->font_glyph_cache;
+    TEST_ASSERT_LESS_OR_EQUAL(LV_FONT_GLYPH_CACHE_SIZE, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL_UINT32(0, get_referenced_cnt());
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_font_glyph_cache_hits_on_redraw(void)
+{
+}
+
+void test_font_glyph_cache_same_rendering(void)
+{
+}
+
+void test_font_glyph_cache_stays_in_budget(void)
+{
+}
+
+#endif
+
+#endif
@@ -0,0 +1,154 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_FONT_FMT_TXT_KERN_INDEX && LV_FONT_MONTSERRAT_14
+
+/*Glyphs of Montserrat 14 (ASCII and the symbols)*/
+#define GLYPH_CNT   158
+
+static lv_font_t pair_font;
+static lv_font_fmt_txt_dsc_t pair_dsc;
+static lv_font_fmt_txt_kern_pair_t kern_pairs;
+
+/*Montserrat 14 with its kerning classes converted to pairs*/
+static void pair_font_create(void)
+{
+    const lv_font_fmt_txt_dsc_t * class_dsc = lv_font_montserrat_14.dsc;
+    const lv_font_fmt_txt_kern_classes_t * classes = class_dsc->kern_dsc;
+
+    uint8_t * ids = lv_malloc(GLYPH_CNT * GLYPH_CNT * 2);
+    int8_t * values = lv_malloc(GLYPH_CNT * GLYPH_CNT);
+    uint32_t cnt = 0;
+    uint32_t l;
+    uint32_t r;
+    for(l = 1; l < GLYPH_CNT; l++) {
+        for(r = 1; r < GLYPH_CNT; r++) {
+            uint8_t lc = classes->left_class_mapping[l];
+            uint8_t rc = classes->right_class_mapping[r];
+            if(lc == 0 || rc == 0) continue;
+            int8_t v = classes->class_pair_values[(lc - 1) * classes->right_class_cnt + (rc - 1)];
+            if(v == 0) continue;
+            ids[cnt * 2] = (uint8_t)l;
+            ids[cnt * 2 + 1] = (uint8_t)r;
+            values[cnt] = v;
+            cnt++;
+        }
+    }
+
+    kern_pairs.glyph_ids = ids;
+    kern_pairs.values = values;
+    kern_pairs.pair_cnt = cnt;
+    kern_pairs.glyph_ids_size = 0;
+
+    pair_dsc = *class_dsc;
+    pair_dsc.kern_dsc = &kern_pairs;
+    pair_dsc.kern_classes = 0;
+
+    pair_font = lv_font_montserrat_14;
+    pair_font.dsc = &pair_dsc;
+}
+
+static void pair_font_delete(void)
+{
+    lv_font_fmt_txt_kern_index_delete(&pair_font);
+    lv_free((void *)kern_pairs.glyph_ids);
+    lv_free((void *)kern_pairs.values);
+}
+
+void setUp(void)
+{
+    pair_font_create();
+}
+
+void tearDown(void)
+{
+    pair_font_delete();
+}
+
+static uint32_t get_adv_w(const lv_font_t * font, uint32_t letter, uint32_t letter_next)
+{
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc_fmt_txt(font, &g, letter, letter_next));
+    return g.adv_w;
+}
+
+static void test_ascii_pairs(void)
+{
+    uint32_t l;
+    uint32_t r;
+    for(l = 0x20; l < 0x7F; l++) {
+        for(r = 0x20; r < 0x7F; r++) {
+            TEST_ASSERT_EQUAL_UINT32(get_adv_w(&lv_font_montserrat_14, l, r), get_adv_w(&pair_font, l, r));
+        }
+    }
+}
+
+void test_font_kern_index_same_kerning(void)
+{
+    TEST_ASSERT_GREATER_THAN_UINT32(100, kern_pairs.pair_cnt);
+
+    /*Binary search*/
+    test_ascii_pairs();
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_font_fmt_txt_kern_index_create(&pair_font));
+    test_ascii_pairs();
+
+    /*The kerning of the symbols is not affected*/
+    TEST_ASSERT_EQUAL_UINT32(get_adv_w(&lv_font_montserrat_14, 0xF001, 'A'), get_adv_w(&pair_font, 0xF001, 'A'));
+}
+
+void test_font_kern_index_size(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(0, lv_font_fmt_txt_kern_index_get_size(&pair_font));
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_font_fmt_txt_kern_index_create(&pair_font));
+    uint32_t size = lv_font_fmt_txt_kern_index_get_size(&pair_font);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(kern_pairs.pair_cnt * 3 / 2 * 5, size);
+
+    /*Creating it again doesn't build a new table*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_font_fmt_txt_kern_index_create(&pair_font));
+    TEST_ASSERT_EQUAL_UINT32(size, lv_font_fmt_txt_kern_index_get_size(&pair_font));
+
+    lv_font_fmt_txt_kern_index_delete(&pair_font);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_font_fmt_txt_kern_index_get_size(&pair_font));
+}
+
+void test_font_kern_index_not_needed(void)
+{
+    /*The kerning classes are indexed directly*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_font_fmt_txt_kern_index_create(&lv_font_montserrat_14));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_font_fmt_txt_kern_index_get_size(&lv_font_montserrat_14));
+
+    lv_font_t font;
+    lv_memzero(&font, sizeof(font));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_font_fmt_txt_kern_index_create(&font));
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_font_kern_index_same_kerning(void)
+{
+}
+
+void test_font_kern_index_size(void)
+{
+}
+
+void test_font_kern_index_not_needed(void)
+{
+}
+
+#endif
+
+#endif
@@ -0,0 +1,107 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t flush_cnt;
+static uint32_t cost_cb_cnt;
+
+static void flush_start_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    flush_cnt++;
+}
+
+/*A fixed overhead per window and the pixels to send*/
+static uint32_t window_cost_cb(lv_display_t * disp, const lv_area_t * area)
+{
+    LV_UNUSED(disp);
+    cost_cb_cnt++;
+    return 2000 + lv_area_get_size(area);
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_refr_now(NULL);
+    flush_cnt = 0;
+    cost_cb_cnt = 0;
+    lv_display_add_event_cb(lv_display_get_default(), flush_start_cb, LV_EVENT_FLUSH_START, NULL);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_display_t * disp = lv_display_get_default();
+    lv_display_set_area_cost_cb(disp, NULL);
+    lv_display_remove_event_cb_with_user_data(disp, flush_start_cb, NULL);
+    lv_refr_now(NULL);
+}
+
+void test_inv_area_overflow_does_not_invalidate_the_screen(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    uint32_t screen_size = lv_display_get_horizontal_resolution(disp) * lv_display_get_vertical_resolution(disp);
+
+    lv_area_t areas[LV_INV_BUF_SIZE * 2];
+    uint32_t i;
+    for(i = 0; i < LV_INV_BUF_SIZE * 2; i++) {
+        lv_area_set(&areas[i], (i % 16) * 40, (i / 16) * 40, (i % 16) * 40 + 9, (i / 16) * 40 + 9);
+        lv_inv_area(disp, &areas[i]);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(LV_INV_BUF_SIZE, disp->inv_p);
+
+    /*Every invalidated area is still covered*/
+    for(i = 0; i < LV_INV_BUF_SIZE * 2; i++) {
+        uint32_t j;
+        for(j = 0; j < disp->inv_p; j++) {
+            if(lv_area_is_in(&areas[i], &disp->inv_areas[j], 0)) break;
+        }
+        TEST_ASSERT_LESS_THAN_UINT32(disp->inv_p, j);
+    }
+
+    /*But the whole screen is not redrawn*/
+    uint32_t inv_size = 0;
+    for(i = 0; i < disp->inv_p; i++) {
+        inv_size += lv_area_get_size(&disp->inv_areas[i]);
+    }
+    TEST_ASSERT_LESS_THAN_UINT32(screen_size / 4, inv_size);
+}
+
+void test_inv_area_default_cost_does_not_join_separate_areas(void)
+{
+    lv_area_t a1 = {10, 10, 19, 19};
+    lv_area_t a2 = {40, 10, 49, 19};
+    lv_inv_area(NULL, &a1);
+    lv_inv_area(NULL, &a2);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(2, flush_cnt);
+}
+
+void test_inv_area_cost_cb_joins_nearby_areas(void)
+{
+    lv_display_set_area_cost_cb(NULL, window_cost_cb);
+
+    lv_area_t a1 = {10, 10, 19, 19};
+    lv_area_t a2 = {40, 10, 49, 19};
+    lv_inv_area(NULL, &a1);
+    lv_inv_area(NULL, &a2);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+    TEST_ASSERT_GREATER_THAN(0, cost_cb_cnt);
+
+    /*Far away areas are still cheaper to redraw separately*/
+    flush_cnt = 0;
+    lv_area_set(&a2, 400, 300, 409, 309);
+    lv_inv_area(NULL, &a1);
+    lv_inv_area(NULL, &a2);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(2, flush_cnt);
+}
+
+#endif
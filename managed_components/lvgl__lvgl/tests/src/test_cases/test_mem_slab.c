@@ -0,0 +1,109 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+#if LV_MEM_SLAB_SIZE_MAX
+
+#define SLAB_PAGE_CNT   (LV_MEM_SLAB_POOL_SIZE / 512)
+#define SLAB_BLOCK_MAX_CNT  (SLAB_PAGE_CNT * (512 / LV_MEM_SLAB_SIZE_MAX))
+
+static lv_mem_monitor_t mon_get(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon;
+}
+
+void test_mem_slab_small_allocations_use_their_size_class(void)
+{
+    lv_mem_monitor_t mon_start = mon_get();
+
+    void * p1 = lv_malloc(1);
+    void * p20 = lv_malloc(20);
+    void * p24 = lv_malloc(24);
+
+    lv_mem_monitor_t mon = mon_get();
+    TEST_ASSERT_EQUAL_UINT32(mon_start.slab[0].used_cnt + 1, mon.slab[0].used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.slab[2].used_cnt + 2, mon.slab[2].used_cnt);
+    TEST_ASSERT_EQUAL_UINT16(24, mon.slab[2].block_size);
+    TEST_ASSERT_EQUAL(mon_start.used_cnt + 3, mon.used_cnt);
+    TEST_ASSERT_EQUAL(mon_start.free_size - 8 - 24 - 24, mon.free_size);
+
+    lv_free(p1);
+    lv_free(p20);
+    lv_free(p24);
+
+    mon = mon_get();
+    TEST_ASSERT_EQUAL_UINT32(mon_start.slab[2].used_cnt, mon.slab[2].used_cnt);
+    TEST_ASSERT_EQUAL(mon_start.free_size, mon.free_size);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.slab_free_page_cnt, mon.slab_free_page_cnt);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+}
+
+void test_mem_slab_realloc_keeps_the_data(void)
+{
+    uint8_t * p = lv_malloc(10);
+    uint32_t i;
+    for(i = 0; i < 10; i++) p[i] = i;
+
+    /*The same size class*/
+    TEST_ASSERT_EQUAL_PTR(p, lv_realloc(p, 16));
+
+    /*Other size classes and the heap*/
+    uint32_t sizes[] = {40, LV_MEM_SLAB_SIZE_MAX, LV_MEM_SLAB_SIZE_MAX + 100, 12};
+    for(i = 0; i < 4; i++) {
+        p = lv_realloc(p, sizes[i]);
+        TEST_ASSERT_NOT_NULL(p);
+        uint32_t j;
+        for(j = 0; j < 10; j++) TEST_ASSERT_EQUAL_UINT8(j, p[j]);
+    }
+
+    lv_free(p);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+}
+
+void test_mem_slab_falls_back_to_the_heap_when_full(void)
+{
+    lv_mem_monitor_t mon_start = mon_get();
+
+    /*More blocks of the largest class than what fits into the pool*/
+    static void * blocks[SLAB_BLOCK_MAX_CNT + 10];
+    uint32_t i;
+    for(i = 0; i < SLAB_BLOCK_MAX_CNT + 10; i++) {
+        blocks[i] = lv_malloc(LV_MEM_SLAB_SIZE_MAX);
+        TEST_ASSERT_NOT_NULL(blocks[i]);
+        lv_memset(blocks[i], 0x55, LV_MEM_SLAB_SIZE_MAX);
+    }
+
+    lv_mem_monitor_t mon = mon_get();
+    TEST_ASSERT_EQUAL_UINT32(0, mon.slab_free_page_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(mon_start.slab_fallback_cnt, mon.slab_fallback_cnt);
+
+    for(i = 0; i < SLAB_BLOCK_MAX_CNT + 10; i++) {
+        lv_free(blocks[i]);
+    }
+
+    /*The empty pages can be used by any size class again*/
+    mon = mon_get();
+    TEST_ASSERT_EQUAL_UINT32(mon_start.slab_free_page_cnt, mon.slab_free_page_cnt);
+    TEST_ASSERT_EQUAL(mon_start.free_size, mon.free_size);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+}
+
+#endif /*LV_MEM_SLAB_SIZE_MAX*/
+#endif /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
+
+#endif
@@ -0,0 +1,131 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+
+static lv_obj_t * create_button(lv_obj_t * parent)
+{
+    lv_obj_t * btn = lv_button_create(parent);
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text(label, "Button");
+    return btn;
+}
+
+void test_style_resolved_cache_steady_redraw_does_not_walk_the_styles(void)
+{
+    create_button(lv_screen_active());
+    lv_refr_now(NULL);
+
+    lv_obj_style_resolved_cache_reset_stats();
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    lv_obj_style_resolved_cache_info_t info;
+    lv_obj_style_resolved_cache_get_info(&info);
+    TEST_ASSERT_GREATER_THAN(0, info.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, info.miss_cnt);
+}
+
+void test_style_resolved_cache_follows_style_changes(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_text_color(&style, lv_color_hex(0xff0000));
+
+    static lv_style_t style_pr;
+    lv_style_init(&style_pr);
+    lv_style_set_text_color(&style_pr, lv_color_hex(0x00ff00));
+
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_t * label = lv_label_create(parent);
+    lv_color_t def_color = lv_obj_get_style_text_color(label, LV_PART_MAIN);
+
+    /*Inherited from a style added to the parent*/
+    lv_obj_add_style(parent, &style, 0);
+    lv_obj_add_style(parent, &style_pr, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    /*The style itself changes*/
+    lv_style_set_text_color(&style, lv_color_hex(0x0000ff));
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    /*The state of the parent changes*/
+    lv_obj_add_state(parent, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+    lv_obj_remove_state(parent, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    /*Local style property*/
+    lv_obj_set_style_text_color(label, lv_color_hex(0x123456), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x123456), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+    lv_obj_remove_local_style_prop(label, LV_STYLE_TEXT_COLOR, 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    /*New parent*/
+    lv_obj_set_parent(label, lv_screen_active());
+    TEST_ASSERT_EQUAL_COLOR(def_color, lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    lv_obj_remove_style(parent, &style, 0);
+    lv_obj_remove_style(parent, &style_pr, LV_STATE_PRESSED);
+    lv_style_reset(&style);
+    lv_style_reset(&style_pr);
+}
+
+void test_style_resolved_cache_handles_temporary_states(void)
+{
+    /*Some widgets (e.g. button matrix and table) set `obj->state` directly while drawing*/
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x00ff00), LV_STATE_CHECKED);
+
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+    obj->state = LV_STATE_CHECKED;
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+    obj->state = LV_STATE_DEFAULT;
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+}
+
+void test_style_resolved_cache_memory_is_capped(void)
+{
+    lv_obj_style_resolved_cache_info_t info;
+    lv_obj_style_resolved_cache_get_info(&info);
+    uint32_t obj_cnt_start = info.obj_cnt;
+    uint32_t mem_used_start = info.mem_used;
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        create_button(lv_screen_active());
+    }
+    lv_refr_now(NULL);
+
+    lv_obj_style_resolved_cache_get_info(&info);
+    TEST_ASSERT_EQUAL_UINT32(LV_OBJ_STYLE_RESOLVED_CACHE_MEM_MAX, info.mem_max);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(info.mem_max, info.mem_used);
+    TEST_ASSERT_GREATER_THAN(obj_cnt_start, info.obj_cnt);
+    TEST_ASSERT_EQUAL_UINT32(info.obj_cnt * sizeof(lv_obj_style_resolved_cache_t), info.mem_used);
+
+    /*The memory is given back when the objects are deleted*/
+    lv_obj_clean(lv_screen_active());
+    lv_obj_style_resolved_cache_get_info(&info);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(obj_cnt_start, info.obj_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(mem_used_start, info.mem_used);
+}
+
+#endif /*LV_OBJ_STYLE_RESOLVED_CACHE_SIZE*/
+
+#endif
@@ -0,0 +1,192 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define LOG_MAX     32
+
+static uint32_t log_buf[LOG_MAX];
+static uint32_t log_cnt;
+
+static void log_cb(lv_timer_t * timer)
+{
+    if(log_cnt < LOG_MAX) log_buf[log_cnt++] = (uint32_t)(uintptr_t)lv_timer_get_user_data(timer);
+}
+
+static void create_one_shot_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    lv_timer_t * t = lv_timer_create(log_cb, 0, (void *)100);
+    lv_timer_set_repeat_count(t, 1);
+}
+
+static void delete_self_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    lv_timer_delete(timer);
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = NULL;
+    while((t = lv_timer_get_next(t)) != NULL) {
+        if(t == timer) return true;
+    }
+    return false;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    log_cnt = 0;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        lv_timer_t * t_next = lv_timer_get_next(t);
+        if(t->timer_cb == log_cb || t->timer_cb == create_one_shot_cb || t->timer_cb == delete_self_cb) {
+            lv_timer_delete(t);
+        }
+        t = t_next;
+    }
+}
+
+void test_timer_runs_the_newest_due_timer_first(void)
+{
+    lv_timer_create(log_cb, 10, (void *)1);
+    lv_timer_create(log_cb, 10, (void *)2);
+    lv_timer_create(log_cb, 30, (void *)3);
+
+    lv_tick_inc(5);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, log_cnt);
+
+    lv_tick_inc(5);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, log_buf[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, log_buf[1]);
+
+    lv_tick_inc(20);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(5, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, log_buf[2]);
+    TEST_ASSERT_EQUAL_UINT32(2, log_buf[3]);
+    TEST_ASSERT_EQUAL_UINT32(1, log_buf[4]);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t1 = lv_timer_create(log_cb, 10, (void *)1);
+    lv_timer_set_repeat_count(t1, 3);
+    lv_timer_t * t2 = lv_timer_create(log_cb, 10, (void *)2);
+    lv_timer_set_repeat_count(t2, 2);
+    lv_timer_set_auto_delete(t2, false);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_tick_inc(10);
+        lv_timer_handler();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(5, log_cnt);
+    TEST_ASSERT_FALSE(timer_exists(t1));
+    TEST_ASSERT_TRUE(timer_exists(t2));
+    TEST_ASSERT_TRUE(lv_timer_get_paused(t2));
+
+    /*Setting the repeat count to 0 deletes the timer in the next call*/
+    lv_timer_t * t3 = lv_timer_create(log_cb, 1000, (void *)3);
+    lv_timer_set_repeat_count(t3, 0);
+    lv_timer_handler();
+    TEST_ASSERT_FALSE(timer_exists(t3));
+    TEST_ASSERT_EQUAL_UINT32(5, log_cnt);
+}
+
+void test_timer_pause_resume_and_ready(void)
+{
+    lv_timer_t * t = lv_timer_create(log_cb, 100, (void *)1);
+    lv_timer_pause(t);
+
+    lv_tick_inc(200);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, log_cnt);
+
+    /*The elapsed time still counts after resuming*/
+    lv_timer_resume(t);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, log_cnt);
+
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, log_cnt);
+
+    lv_timer_ready(t);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, log_cnt);
+
+    /*Reset restarts the period*/
+    lv_tick_inc(90);
+    lv_timer_reset(t);
+    lv_tick_inc(90);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, log_cnt);
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, log_cnt);
+
+    /*A new period is applied to the current wait*/
+    lv_timer_set_period(t, 20);
+    lv_tick_inc(20);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(4, log_cnt);
+}
+
+void test_timer_created_and_deleted_in_callback(void)
+{
+    lv_timer_create(log_cb, 10, (void *)1);
+    lv_timer_create(delete_self_cb, 10, (void *)2);
+    lv_timer_create(create_one_shot_cb, 10, (void *)3);
+
+    /*The new timer is ready immediately so it runs in the same call*/
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(4, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, log_buf[0]);
+    TEST_ASSERT_EQUAL_UINT32(100, log_buf[1]);
+    TEST_ASSERT_EQUAL_UINT32(2, log_buf[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, log_buf[3]);
+}
+
+void test_timer_time_until_next(void)
+{
+    /*Let the other timers (display, input devices) run now*/
+    lv_tick_inc(1000);
+    lv_timer_handler();
+
+    lv_timer_t * t1 = lv_timer_create(log_cb, 7, (void *)1);
+    lv_timer_create(log_cb, 1000, (void *)2);
+
+    uint32_t next = lv_timer_handler();
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(7, next);
+
+    lv_tick_inc(3);
+    next = lv_timer_handler();
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(4, next);
+
+    lv_timer_pause(t1);
+    lv_tick_inc(4);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, log_cnt);
+
+    lv_timer_ready(t1);
+    lv_timer_resume(t1);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_get_time_until_next());
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, log_cnt);
+}
+
+#endif
@@ -0,0 +1,57 @@
+/* Performance test for running many animations with the built-in paths */
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "unity/unity.h"
+
+#define ANIM_CNT    200
+
+static int32_t values[ANIM_CNT];
+
+static void exec_cb(void * var, int32_t v)
+{
+    *(int32_t *)var = v;
+}
+
+/*Advance the time by one display period and run the animations, as the animation timer does*/
+static void run_anims(uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_tick_inc(LV_DEF_REFR_PERIOD);
+        lv_anim_refr_now();
+    }
+}
+
+void setUp(void)
+{
+    /*E.g. list items, indicators and labels sliding and fading in*/
+    static const lv_anim_path_cb_t paths[] = {
+        lv_anim_path_ease_in, lv_anim_path_ease_out, lv_anim_path_ease_in_out, lv_anim_path_overshoot
+    };
+
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &values[i]);
+        lv_anim_set_exec_cb(&a, exec_cb);
+        lv_anim_set_values(&a, 0, 1000 + i);
+        lv_anim_set_duration(&a, 500 + i);
+        lv_anim_set_reverse_duration(&a, 500 + i);
+        lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+        lv_anim_set_path_cb(&a, paths[i % 4]);
+        lv_anim_start(&a);
+    }
+}
+
+void tearDown(void)
+{
+    lv_anim_delete_all();
+}
+
+void test_anim_many_ease_anims(void)
+{
+    TEST_ASSERT_MAX_TIME(run_anims, 20, 1000);
+}
+
+#endif
@@ -0,0 +1,130 @@
+/* Performance test for the dependency check of the draw task dispatcher */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include <stdio.h>
+#include <time.h>
+
+#define COLS    30
+#define ROWS    20
+#define TASK_CNT (COLS * ROWS)
+
+static lv_layer_t layer;
+
+/*The same as `lv_draw_get_next_available_task` but checks all older draw tasks*/
+static lv_draw_task_t * get_next_full_scan(lv_layer_t * l, lv_draw_task_t * t_prev, uint8_t draw_unit_id)
+{
+    lv_draw_task_t * t = t_prev ? t_prev->next : l->draw_task_head;
+    while(t) {
+        if(t->state == LV_DRAW_TASK_STATE_WAITING &&
+           (t->preferred_draw_unit_id == draw_unit_id || t->preferred_draw_unit_id == LV_DRAW_UNIT_NONE)) {
+            lv_draw_task_t * t_old = l->draw_task_head;
+            while(t_old != t) {
+                lv_area_t a;
+                if(t_old->state != LV_DRAW_TASK_STATE_FINISHED &&
+                   !(t_old->state == LV_DRAW_TASK_STATE_QUEUED && t_old->preferred_draw_unit_id == draw_unit_id) &&
+                   lv_area_intersect(&a, &t_old->_real_area, &t->_real_area)) break;
+                t_old = t_old->next;
+            }
+            if(t_old == t) return t;
+        }
+        t = t->next;
+    }
+    return NULL;
+}
+
+/*Let a draw unit collect all the draw tasks it could take now, as a draw unit with a queue does*/
+static uint32_t collect(lv_draw_task_t * (*get_next)(lv_layer_t *, lv_draw_task_t *, uint8_t))
+{
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_draw_task_t * t = NULL;
+        while((t = get_next(&layer, t, 1)) != NULL) cnt++;
+    }
+    return cnt;
+}
+
+/*The grid is used only with more than one draw unit. Add one which never takes draw tasks.*/
+static int32_t dummy_unit_dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * l)
+{
+    LV_UNUSED(draw_unit);
+    LV_UNUSED(l);
+    return LV_DRAW_UNIT_IDLE;
+}
+
+static void add_dummy_unit(void)
+{
+    if(lv_draw_get_unit_count() > 1) return;
+    lv_draw_unit_t * unit = lv_draw_create_unit(sizeof(lv_draw_unit_t));
+    unit->name = "DUMMY";
+    unit->dispatch_cb = dummy_unit_dispatch;
+}
+
+void setUp(void)
+{
+    add_dummy_unit();
+    lv_layer_init(&layer);
+    lv_area_set(&layer.buf_area, 0, 0, 479, 319);
+    layer._clip_area = layer.buf_area;
+    layer.phy_clip_area = layer.buf_area;
+
+    /*Many small widgets, e.g. labels, icons and tick marks.
+     *Every 3rd of them is already queued by an other draw unit.*/
+    int32_t x, y;
+    for(y = 0; y < ROWS; y++) {
+        for(x = 0; x < COLS; x++) {
+            lv_area_t a = {x * 16, y * 16, x * 16 + 13, y * 16 + 13};
+            lv_draw_task_t * t = lv_draw_add_task(&layer, &a, LV_DRAW_TASK_TYPE_FILL);
+            lv_draw_finalize_task_creation(&layer, t);
+            if((x + y) % 3 == 0) {
+                t->state = LV_DRAW_TASK_STATE_QUEUED;
+                t->preferred_draw_unit_id = 2;
+            }
+            else {
+                t->state = LV_DRAW_TASK_STATE_WAITING;
+                t->preferred_draw_unit_id = 1;
+            }
+        }
+    }
+}
+
+void tearDown(void)
+{
+    /*Remove the draw tasks without letting the real draw units render them*/
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
+        t = t->next;
+    }
+    lv_draw_unit_t * unit_head = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    LV_GLOBAL_DEFAULT()->draw_info.unit_head = NULL;
+    lv_draw_dispatch_layer(NULL, &layer);
+    LV_GLOBAL_DEFAULT()->draw_info.unit_head = unit_head;
+}
+
+void test_draw_dispatch_many_tasks(void)
+{
+    clock_t t_ref = clock();
+    uint32_t cnt_ref = collect(get_next_full_scan);
+    t_ref = clock() - t_ref;
+
+    clock_t t_act = clock();
+    uint32_t cnt_act = collect(lv_draw_get_next_available_task);
+    t_act = clock() - t_act;
+
+    TEST_ASSERT_EQUAL_UINT32(cnt_ref, cnt_act);
+    TEST_ASSERT_GREATER_THAN(TASK_CNT, cnt_act);
+
+    char buf[128];
+    snprintf(buf, sizeof(buf), "%d draw tasks: full scan %.2f ms, lv_draw_get_next_available_task %.2f ms",
+             TASK_CNT, (double)t_ref * 1000.0 / CLOCKS_PER_SEC, (double)t_act * 1000.0 / CLOCKS_PER_SEC);
+    TEST_MESSAGE(buf);
+
+#if LV_DRAW_TASK_GRID_LEVELS
+    TEST_ASSERT_LESS_THAN(t_ref, t_act);
+#endif
+
+    TEST_ASSERT_MAX_TIME(collect, 10, lv_draw_get_next_available_task);
+}
+#endif
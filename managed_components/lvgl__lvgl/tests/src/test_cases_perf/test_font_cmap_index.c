@@ -0,0 +1,72 @@
+/* Performance test of the glyph lookups of a CJK font with and without the cmap lookup tables */
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include <time.h>
+
+#define MEASURE_CNT     500
+
+static const char * paragraph =
+    "春天来了，公园里的花都开了。小朋友们在草地上放风筝，老人们在树下下棋、聊天。"
+    "河边的柳树长出了新的叶子，风一吹，柳枝轻轻地摆动，好像在跳舞。"
+    "我和妈妈沿着小路慢慢地走，一边看风景，一边说话。妈妈告诉我，一年之计在于春，"
+    "我们要珍惜时间，好好学习，认真生活。中午我们在湖边的小饭馆吃了面条和饺子，"
+    "下午又去图书馆借了几本关于自然和历史的书。回家的路上，天空中出现了一道美丽的彩虹。";
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+#if LV_FONT_FMT_TXT_CMAP_INDEX && LV_FONT_SOURCE_HAN_SANS_SC_16_CJK
+
+/*Measure the paragraph as a label does when its text is set*/
+static void measure(const lv_font_t * font)
+{
+    lv_point_t size;
+    uint32_t i;
+    for(i = 0; i < MEASURE_CNT; i++) {
+        lv_text_get_size(&size, paragraph, font, 0, 0, 300, LV_TEXT_FLAG_NONE);
+    }
+}
+
+static uint32_t time_measure(const lv_font_t * font)
+{
+    clock_t t = clock();
+    measure(font);
+    return (uint32_t)((clock() - t) * 1000 / CLOCKS_PER_SEC);
+}
+
+void test_font_cmap_index_cjk_paragraph(void)
+{
+    const lv_font_t * font = &lv_font_source_han_sans_sc_16_cjk;
+
+    uint32_t bsearch_time = time_measure(font);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_font_fmt_txt_cmap_index_create(font));
+    uint32_t index_time = time_measure(font);
+
+    char buf[128];
+    lv_snprintf(buf, sizeof(buf), "%d measurements of a CJK paragraph: binary search %d ms, lookup tables %d ms (%d bytes)",
+                MEASURE_CNT, (int)bsearch_time, (int)index_time, (int)lv_font_fmt_txt_cmap_index_get_size(font));
+    TEST_MESSAGE(buf);
+
+    TEST_ASSERT_LESS_THAN_UINT32(bsearch_time, index_time);
+    TEST_ASSERT_MAX_TIME(measure, 100, font);
+
+    lv_font_fmt_txt_cmap_index_delete(font);
+}
+
+#else
+
+void test_font_cmap_index_cjk_paragraph(void)
+{
+}
+
+#endif
+
+#endif
@@ -0,0 +1,121 @@
+/* Performance test of the kerning of a long label with and without the kerning hash table */
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include <time.h>
+
+#define MEASURE_CNT     500
+
+/*Glyphs of Montserrat 14 (ASCII and the symbols)*/
+#define GLYPH_CNT       158
+
+static const char * long_text =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut auctor sed dui interdum convallis. "
+    "Proin in ante magna. Pellentesque placerat condimentum erat ac laoreet. Cras mi eros, convallis vitae "
+    "massa ac, blandit sodales urna. Proin tincidunt fermentum leo a volutpat. Donec ut blandit tortor. "
+    "Duis elementum nibh nec consequat sagittis. AVATAR, WAVY, Today: 7.4 kW; Yesterday: 11.7 kW. "
+    "Vestibulum ante ipsum primis in faucibus orci luctus et ultrices posuere cubilia curae.";
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+#if LV_FONT_FMT_TXT_KERN_INDEX && LV_FONT_MONTSERRAT_14
+
+static lv_font_t pair_font;
+static lv_font_fmt_txt_dsc_t pair_dsc;
+static lv_font_fmt_txt_kern_pair_t kern_pairs;
+
+/*Montserrat 14 with its kerning classes converted to pairs*/
+static void pair_font_create(void)
+{
+    const lv_font_fmt_txt_dsc_t * class_dsc = lv_font_montserrat_14.dsc;
+    const lv_font_fmt_txt_kern_classes_t * classes = class_dsc->kern_dsc;
+
+    uint8_t * ids = lv_malloc(GLYPH_CNT * GLYPH_CNT * 2);
+    int8_t * values = lv_malloc(GLYPH_CNT * GLYPH_CNT);
+    uint32_t cnt = 0;
+    uint32_t l;
+    uint32_t r;
+    for(l = 1; l < GLYPH_CNT; l++) {
+        for(r = 1; r < GLYPH_CNT; r++) {
+            uint8_t lc = classes->left_class_mapping[l];
+            uint8_t rc = classes->right_class_mapping[r];
+            if(lc == 0 || rc == 0) continue;
+            int8_t v = classes->class_pair_values[(lc - 1) * classes->right_class_cnt + (rc - 1)];
+            if(v == 0) continue;
+            ids[cnt * 2] = (uint8_t)l;
+            ids[cnt * 2 + 1] = (uint8_t)r;
+            values[cnt] = v;
+            cnt++;
+        }
+    }
+
+    kern_pairs.glyph_ids = ids;
+    kern_pairs.values = values;
+    kern_pairs.pair_cnt = cnt;
+    kern_pairs.glyph_ids_size = 0;
+
+    pair_dsc = *class_dsc;
+    pair_dsc.kern_dsc = &kern_pairs;
+    pair_dsc.kern_classes = 0;
+
+    pair_font = lv_font_montserrat_14;
+    pair_font.dsc = &pair_dsc;
+}
+
+/*Measure the text as a label does when its text is set*/
+static void measure(const lv_font_t * font)
+{
+    lv_point_t size;
+    uint32_t i;
+    for(i = 0; i < MEASURE_CNT; i++) {
+        lv_text_get_size(&size, long_text, font, 0, 0, 300, LV_TEXT_FLAG_NONE);
+    }
+}
+
+static uint32_t time_measure(const lv_font_t * font)
+{
+    clock_t t = clock();
+    measure(font);
+    return (uint32_t)((clock() - t) * 1000 / CLOCKS_PER_SEC);
+}
+
+void test_font_kern_index_long_label(void)
+{
+    pair_font_create();
+
+    uint32_t bsearch_time = time_measure(&pair_font);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_font_fmt_txt_kern_index_create(&pair_font));
+    uint32_t index_time = time_measure(&pair_font);
+
+    char buf[160];
+    lv_snprintf(buf, sizeof(buf),
+                "%d measurements of a long label: binary search of %d pairs %d ms, hash table %d ms (%d bytes)",
+                MEASURE_CNT, (int)kern_pairs.pair_cnt, (int)bsearch_time, (int)index_time,
+                (int)lv_font_fmt_txt_kern_index_get_size(&pair_font));
+    TEST_MESSAGE(buf);
+
+    TEST_ASSERT_LESS_THAN_UINT32(bsearch_time, index_time);
+    TEST_ASSERT_MAX_TIME(measure, 100, &pair_font);
+
+    lv_font_fmt_txt_kern_index_delete(&pair_font);
+    lv_free((void *)kern_pairs.glyph_ids);
+    lv_free((void *)kern_pairs.values);
+}
+
+#else
+
+void test_font_kern_index_long_label(void)
+{
+}
+
+#endif
+
+#endif
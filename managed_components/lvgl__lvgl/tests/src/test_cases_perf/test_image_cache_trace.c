@@ -0,0 +1,173 @@
+/* Performance and hit rate test of the image cache classes replaying image access traces */
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define CACHE_SIZE      (64 * 1024)
+#define TRACE_LEN       20000
+#define ICON_CNT        12
+#define PHOTO_CNT       200
+
+/*An access of the image decoder to the cache*/
+typedef struct {
+    uint16_t id;
+    uint32_t size;
+} trace_access_t;
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+    uint32_t id;
+} test_data_t;
+
+typedef struct {
+    uint32_t hit_cnt;
+    uint32_t decoded_size;
+} replay_res_t;
+
+static trace_access_t trace[TRACE_LEN];
+static uint32_t rnd_state;
+
+static uint32_t rnd(uint32_t max)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return (rnd_state >> 16) % max;
+}
+
+static lv_cache_compare_res_t compare_cb(const test_data_t * lhs, const test_data_t * rhs)
+{
+    if(lhs->id != rhs->id) return lhs->id > rhs->id ? 1 : -1;
+    return 0;
+}
+
+static uint32_t hash_cb(const test_data_t * node)
+{
+    return node->id * 2654435761u;
+}
+
+static void free_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+}
+
+/**
+ * A home screen with icons drawn in every frame (the first ones more often)
+ * and a gallery which shows large photos while scrolling.
+ * @param photo_repeat_pct  probability of showing the same photo again
+ */
+static void build_trace(uint32_t photo_repeat_pct)
+{
+    uint32_t len = 0;
+    uint32_t photo = ICON_CNT;
+    rnd_state = 1;
+    while(len < TRACE_LEN) {
+        uint32_t i;
+        for(i = 0; i < 6 && len < TRACE_LEN; i++) {
+            uint32_t id = rnd(ICON_CNT / 2) + (rnd(4) == 0 ? ICON_CNT / 2 : 0);
+            trace[len].id = id;
+            trace[len].size = 1024 + id * 256;
+            len++;
+        }
+
+        if(rnd(3) == 0 && len < TRACE_LEN) {
+            trace[len].id = photo;
+            trace[len].size = 20 * 1024 + (photo % 20) * 1024;
+            len++;
+            if(rnd(100) >= photo_repeat_pct) photo++;
+            if(photo == ICON_CNT + PHOTO_CNT) photo = ICON_CNT;
+        }
+    }
+}
+
+/*Decode the image on miss, as the image decoder does*/
+static void replay(lv_cache_t * cache, replay_res_t * res)
+{
+    uint32_t i;
+    for(i = 0; i < TRACE_LEN; i++) {
+        test_data_t search_key = { .slot.size = trace[i].size, .id = trace[i].id };
+        lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+        if(entry) {
+            res->hit_cnt++;
+        }
+        else {
+            entry = lv_cache_add(cache, &search_key, NULL);
+            TEST_ASSERT_NOT_NULL(entry);
+            res->decoded_size += trace[i].size;
+        }
+        lv_cache_release(cache, entry, NULL);
+    }
+}
+
+static lv_cache_t * create_cache(const lv_cache_class_t * cache_class)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)hash_cb,
+    };
+    return lv_cache_create(cache_class, sizeof(test_data_t), CACHE_SIZE, ops);
+}
+
+static void replay_both(const char * name, replay_res_t * lru_res, replay_res_t * lfu_res)
+{
+    lv_cache_t * lru = create_cache(&lv_cache_class_lru_rb_size);
+    lv_cache_t * lfu = create_cache(&lv_cache_class_tinylfu_size);
+
+    replay(lru, lru_res);
+    TEST_ASSERT_MAX_TIME(replay, 20, lfu, lfu_res);
+
+    char buf[160];
+    lv_snprintf(buf, sizeof(buf), "%s, LRU:     %d %% hits, %d kB decoded", name,
+                (int)(lru_res->hit_cnt * 100 / TRACE_LEN), (int)(lru_res->decoded_size / 1024));
+    TEST_MESSAGE(buf);
+
+    lv_cache_tinylfu_stats_t stats;
+    lv_cache_tinylfu_get_stats(lfu, &stats);
+    lv_snprintf(buf, sizeof(buf), "%s, TinyLFU: %d %% hits, %d kB decoded, %d rejected, %d evicted (%d kB)", name,
+                (int)(lfu_res->hit_cnt * 100 / TRACE_LEN), (int)(lfu_res->decoded_size / 1024),
+                (int)stats.reject_cnt, (int)stats.evict_cnt, (int)(stats.evict_size / 1024));
+    TEST_MESSAGE(buf);
+
+    TEST_ASSERT_EQUAL_UINT32(lfu_res->hit_cnt, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(TRACE_LEN, stats.hit_cnt + stats.miss_cnt);
+
+    lv_cache_destroy(lru, NULL);
+    lv_cache_destroy(lfu, NULL);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_image_cache_trace_one_shot_photos(void)
+{
+    build_trace(0);
+
+    replay_res_t lru_res = {0};
+    replay_res_t lfu_res = {0};
+    replay_both("one-shot photos", &lru_res, &lfu_res);
+
+    /*The icons are not flushed by the photos*/
+    TEST_ASSERT_GREATER_THAN_UINT32(lru_res.hit_cnt, lfu_res.hit_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(lru_res.decoded_size, lfu_res.decoded_size);
+}
+
+void test_image_cache_trace_revisited_photos(void)
+{
+    build_trace(50);
+
+    replay_res_t lru_res = {0};
+    replay_res_t lfu_res = {0};
+    replay_both("revisited photos", &lru_res, &lfu_res);
+
+    /*More hits, but the photos shown twice are decoded twice as they are used less than the icons*/
+    TEST_ASSERT_GREATER_THAN_UINT32(lru_res.hit_cnt, lfu_res.hit_cnt);
+}
+
+#endif
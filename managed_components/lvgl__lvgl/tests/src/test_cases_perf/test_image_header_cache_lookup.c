@@ -0,0 +1,115 @@
+/* Performance test of header cache lookups with file path keys */
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include <time.h>
+
+#define PATH_CNT        128
+#define LOOKUP_CNT      200000
+
+/*As `lv_image_header_cache_data_t`: the path is duplicated when it's added*/
+typedef struct {
+    const char * src;
+    lv_image_header_t header;
+} test_data_t;
+
+static char paths[PATH_CNT][64];
+
+static lv_cache_compare_res_t compare_cb(const test_data_t * lhs, const test_data_t * rhs)
+{
+    int32_t cmp_res = lv_strcmp(lhs->src, rhs->src);
+    if(cmp_res != 0) return cmp_res > 0 ? 1 : -1;
+    return 0;
+}
+
+static uint32_t hash_cb(const test_data_t * node)
+{
+    uint32_t hash = 2166136261u;
+    const uint8_t * c = (const uint8_t *)node->src;
+    while(*c) hash = (hash ^ *c++) * 16777619u;
+    return hash;
+}
+
+static void free_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free((void *)node->src);
+}
+
+static lv_cache_t * create_cache(const lv_cache_class_t * cache_class)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)hash_cb,
+    };
+    lv_cache_t * cache = lv_cache_create(cache_class, sizeof(test_data_t), PATH_CNT, ops);
+
+    uint32_t i;
+    for(i = 0; i < PATH_CNT; i++) {
+        test_data_t search_key = { .src = lv_strdup(paths[i]) };
+        search_key.header.w = (uint16_t)i;
+        lv_cache_entry_t * entry = lv_cache_add(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+
+    return cache;
+}
+
+/*Look up the headers as `lv_image_decoder_get_info` does when drawing a screen of icons*/
+static void lookup(lv_cache_t * cache)
+{
+    uint32_t i;
+    for(i = 0; i < LOOKUP_CNT; i++) {
+        uint32_t idx = (i * 37) % PATH_CNT;
+        test_data_t search_key = { .src = paths[idx] };
+        lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+        TEST_ASSERT_EQUAL_UINT32(idx, ((test_data_t *)lv_cache_entry_get_data(entry))->header.w);
+        lv_cache_release(cache, entry, NULL);
+    }
+}
+
+static uint32_t time_lookup(lv_cache_t * cache)
+{
+    clock_t t = clock();
+    lookup(cache);
+    return (uint32_t)((clock() - t) * 1000 / CLOCKS_PER_SEC);
+}
+
+void setUp(void)
+{
+    /*Paths with a long common prefix as in a resource folder*/
+    uint32_t i;
+    for(i = 0; i < PATH_CNT; i++) {
+        lv_snprintf(paths[i], sizeof(paths[i]), "A:/resources/images/icons/weather_%03d.bin", (int)i);
+    }
+}
+
+void tearDown(void)
+{
+}
+
+void test_image_header_cache_lookup(void)
+{
+    lv_cache_t * rb = create_cache(&lv_cache_class_lru_rb_count);
+    lv_cache_t * ht = create_cache(&lv_cache_class_lru_ht_count);
+
+    uint32_t rb_time = time_lookup(rb);
+    uint32_t ht_time = time_lookup(ht);
+
+    char buf[128];
+    lv_snprintf(buf, sizeof(buf), "%d lookups of %d paths: red-black tree %d ms, hash table %d ms",
+                LOOKUP_CNT, PATH_CNT, (int)rb_time, (int)ht_time);
+    TEST_MESSAGE(buf);
+
+    TEST_ASSERT_LESS_THAN_UINT32(rb_time, ht_time);
+    TEST_ASSERT_MAX_TIME(lookup, 100, ht);
+
+    lv_cache_destroy(rb, NULL);
+    lv_cache_destroy(ht, NULL);
+}
+
+#endif
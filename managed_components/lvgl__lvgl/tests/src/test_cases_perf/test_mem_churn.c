@@ -0,0 +1,174 @@
+/* Performance and fragmentation test for a long running UI which creates and deletes widgets */
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "unity/unity.h"
+#include <stdio.h>
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+
+#define SLOT_CNT    20
+#define BUF_CNT     4
+#define STEP_CNT    (3 * 3600)    /*3 hours with one change per second*/
+#define HEAP_FREE   (64 * 1024)   /*Memory left free for the test as on a small MCU*/
+
+static lv_obj_t * slots[SLOT_CNT];
+static void * bufs[BUF_CNT];
+static void * ballast;
+static uint32_t buf_fail_cnt;
+static uint32_t rnd_state;
+
+static uint32_t rnd(uint32_t max)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return (rnd_state >> 16) % max;
+}
+
+static void timer_cb(lv_timer_t * t)
+{
+    LV_UNUSED(t);
+}
+
+static void event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+}
+
+/*A random widget as a screen of a settings menu or a notification would create it*/
+static lv_obj_t * create_widget(void)
+{
+    lv_obj_t * obj;
+    char buf[64];
+    switch(rnd(4)) {
+        case 0:
+            obj = lv_label_create(lv_screen_active());
+            lv_snprintf(buf, sizeof(buf), "%.*s", (int)rnd(40) + 1, "Lorem ipsum dolor sit amet, consectetur adipiscing");
+            lv_label_set_text(obj, buf);
+            break;
+        case 1:
+            obj = lv_button_create(lv_screen_active());
+            lv_label_create(obj);
+            lv_obj_add_event_cb(obj, event_cb, LV_EVENT_CLICKED, NULL);
+            break;
+        case 2:
+            obj = lv_bar_create(lv_screen_active());
+            lv_bar_set_value(obj, rnd(100), LV_ANIM_ON);
+            break;
+        default:
+            obj = lv_obj_create(lv_screen_active());
+            lv_obj_set_style_bg_color(obj, lv_color_hex(rnd(0xffffff)), 0);
+            lv_obj_set_style_radius(obj, rnd(10), 0);
+            lv_timer_t * t = lv_timer_create(timer_cb, 1000, NULL);
+            lv_obj_add_event_cb(obj, event_cb, LV_EVENT_DELETE, t);
+            break;
+    }
+
+    return obj;
+}
+
+static void delete_widget(lv_obj_t * obj)
+{
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_event_count(obj); i++) {
+        lv_event_dsc_t * dsc = lv_obj_get_event_dsc(obj, i);
+        if(lv_event_dsc_get_cb(dsc) == event_cb && lv_event_dsc_get_user_data(dsc)) {
+            lv_timer_delete(lv_event_dsc_get_user_data(dsc));
+        }
+    }
+    lv_obj_delete(obj);
+}
+
+/*Replace some widgets, and sometimes an image sized buffer, in every step*/
+static void churn(uint32_t step_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < step_cnt; i++) {
+        uint32_t j;
+        for(j = 0; j < 2; j++) {
+            uint32_t s = rnd(SLOT_CNT);
+            if(slots[s]) delete_widget(slots[s]);
+            slots[s] = create_widget();
+        }
+
+        if(rnd(10) == 0) {
+            uint32_t b = rnd(BUF_CNT);
+            lv_free(bufs[b]);
+            bufs[b] = lv_malloc(1024 + rnd(4096));
+            if(bufs[b] == NULL) buf_fail_cnt++;
+        }
+
+        lv_anim_delete_all();
+    }
+}
+
+static void clean_up(void)
+{
+    uint32_t i;
+    for(i = 0; i < SLOT_CNT; i++) {
+        if(slots[i]) delete_widget(slots[i]);
+        slots[i] = NULL;
+    }
+    for(i = 0; i < BUF_CNT; i++) {
+        lv_free(bufs[i]);
+        bufs[i] = NULL;
+    }
+}
+
+void setUp(void)
+{
+    rnd_state = 1;
+    buf_fail_cnt = 0;
+
+    /*Use only a part of the heap of the test*/
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    ballast = lv_malloc(mon.free_biggest_size - HEAP_FREE);
+}
+
+void tearDown(void)
+{
+    clean_up();
+    lv_free(ballast);
+}
+
+void test_mem_churn(void)
+{
+    /*Let the timer, animation, style, etc. modules allocate their internal buffers*/
+    churn(100);
+    clean_up();
+
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+
+    TEST_ASSERT_MAX_TIME(churn, 5000, STEP_CNT);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+
+    char buf[160];
+    lv_snprintf(buf, sizeof(buf), "after %d steps: free %d, biggest free %d, frag %d %%, failed buffers %d",
+                STEP_CNT, (int)mon.free_size, (int)mon.free_biggest_size, mon.frag_pct, (int)buf_fail_cnt);
+    TEST_MESSAGE(buf);
+
+#if LV_MEM_SLAB_SIZE_MAX
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_SIZE_MAX / 8; i++) {
+        if(mon.slab[i].page_cnt == 0) continue;
+        lv_snprintf(buf, sizeof(buf), "slab %3d bytes: %3d pages, %4d used, %4d free",
+                    mon.slab[i].block_size, mon.slab[i].page_cnt, (int)mon.slab[i].used_cnt, (int)mon.slab[i].free_cnt);
+        TEST_MESSAGE(buf);
+    }
+    lv_snprintf(buf, sizeof(buf), "slab: %d free pages, %d fallbacks to the heap",
+                (int)mon.slab_free_page_cnt, (int)mon.slab_fallback_cnt);
+    TEST_MESSAGE(buf);
+#endif
+
+    /*Nothing is lost. The internal buffers might have grown a little.*/
+    clean_up();
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_LESS_OR_EQUAL(1024, mon_start.free_size - mon.free_size);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+}
+
+#endif /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
+
+#endif
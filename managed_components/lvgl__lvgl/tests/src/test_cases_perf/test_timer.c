@@ -0,0 +1,53 @@
+/* Performance test for the timer handler with many waiting timers */
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "unity/unity.h"
+
+#define TIMER_CNT   200
+
+static lv_timer_t * timers[TIMER_CNT];
+static uint32_t run_cnt;
+
+static void timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    run_cnt++;
+}
+
+/*Advance the time by 1 ms and call the handler, as a main loop does*/
+static void run_handler(uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+}
+
+void setUp(void)
+{
+    /*Many widget timers with long periods, e.g. blinking cursors, clocks, slideshows*/
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        timers[i] = lv_timer_create(timer_cb, 1000 + i * 50, NULL);
+    }
+    run_cnt = 0;
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        lv_timer_delete(timers[i]);
+    }
+}
+
+void test_timer_handler_with_many_waiting_timers(void)
+{
+    TEST_ASSERT_MAX_TIME(run_handler, 20, 10000);
+
+    /*Every timer has run a few times*/
+    TEST_ASSERT_GREATER_OR_EQUAL(TIMER_CNT, run_cnt);
+}
+
+#endif